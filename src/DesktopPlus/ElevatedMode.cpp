@@ -4,14 +4,19 @@
 
 #include "InterprocessMessaging.h"
 #include "InputSimulator.h"
+#include "Actions.h"
 #include "WindowManager.h"
 #include "Util.h"
 #include "Logging.h"
 
+#define ELEVATED_TIMER_KEYBOARD_TEXT 1
+
 static bool g_ElevatedMode_ComInitDone = false;
 
 LRESULT CALLBACK WndProcElevated(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 bool HandleIPCMessage(MSG msg);
+LPARAM CoalesceQueuedMoveMessages(const MSG& msg);
+float CoalesceQueuedWheelMessages(const MSG& msg);
 
 int ElevatedModeEnter(HINSTANCE hinstance)
 {
@@ -75,8 +80,8 @@ int ElevatedModeEnter(HINSTANCE hinstance)
     MSG msg;
     while (::GetMessage(&msg, 0, 0, 0))
     {
-        //Custom IPC messages
-        if (msg.message >= 0xC000)
+        //Custom IPC messages and the keyboard text timer
+        if ( (msg.message >= 0xC000) || (msg.message == WM_TIMER) )
         {
             HandleIPCMessage(msg);
         }
@@ -139,6 +144,19 @@ bool HandleIPCMessage(MSG msg)
 
     static std::string action_exe_path;
     static std::string action_exe_arg;
+    static bool keyboard_text_timer_active = false;
+
+    //Remaining chunks of queued keyboard text are sent on a timer
+    if (msg.message == WM_TIMER)
+    {
+        if ( (msg.wParam == ELEVATED_TIMER_KEYBOARD_TEXT) && (!input_sim.KeyboardTextFinish()) )
+        {
+            ::KillTimer(msg.hwnd, ELEVATED_TIMER_KEYBOARD_TEXT);
+            keyboard_text_timer_active = false;
+        }
+
+        return true;
+    }
 
     //Input strings come as WM_COPYDATA
     if (msg.message == WM_COPYDATA)
@@ -196,22 +214,24 @@ bool HandleIPCMessage(MSG msg)
                 }
                 case ipceact_mouse_move:
                 {
-                    input_sim.MouseMove(GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam));
+                    const LPARAM pos = CoalesceQueuedMoveMessages(msg);
+                    input_sim.MouseMove(GET_X_LPARAM(pos), GET_Y_LPARAM(pos));
                     break;
                 };
                 case ipceact_mouse_hwheel:
                 {
-                    input_sim.MouseWheelHorizontal(pun_cast<float, LPARAM>(msg.lParam));
+                    input_sim.MouseWheelHorizontal(CoalesceQueuedWheelMessages(msg));
                     break;
                 };
                 case ipceact_mouse_vwheel:
                 {
-                    input_sim.MouseWheelVertical(pun_cast<float, LPARAM>(msg.lParam));
+                    input_sim.MouseWheelVertical(CoalesceQueuedWheelMessages(msg));
                     break;
                 };
                 case ipceact_pen_move:
                 {
-                    input_sim.PenMove(GET_X_LPARAM(msg.lParam), GET_Y_LPARAM(msg.lParam));
+                    const LPARAM pos = CoalesceQueuedMoveMessages(msg);
+                    input_sim.PenMove(GET_X_LPARAM(pos), GET_Y_LPARAM(pos));
                     break;
                 };
                 case ipceact_pen_button_down:
@@ -278,7 +298,12 @@ bool HandleIPCMessage(MSG msg)
                 }
                 case ipceact_keyboard_text_finish:
                 {
-                    input_sim.KeyboardTextFinish();
+                    //Send the first chunk right away and leave the rest to the timer. Text queued while it's running is picked up by it as well
+                    if ( (!keyboard_text_timer_active) && (input_sim.KeyboardTextFinish()) )
+                    {
+                        ::SetTimer(msg.hwnd, ELEVATED_TIMER_KEYBOARD_TEXT, KEYBOARD_TEXT_CHUNK_DELAY_MS, nullptr);
+                        keyboard_text_timer_active = true;
+                    }
                     break;
                 }
                 case ipceact_launch_application:
@@ -298,7 +323,7 @@ bool HandleIPCMessage(MSG msg)
 
                     if (!path_wstr.empty())
                     {   
-                        ::ShellExecute(nullptr, nullptr, path_wstr.c_str(), arg_wstr.c_str(), nullptr, SW_SHOWNORMAL);
+                        ActionManager::LaunchApplicationAsync(path_wstr, arg_wstr);
                     }
                     break;
                 }
@@ -314,3 +339,35 @@ bool HandleIPCMessage(MSG msg)
 
     return true;
 }
+
+LPARAM CoalesceQueuedMoveMessages(const MSG& msg)
+{
+    //High-rate laser pointer input can queue up a lot of moves while we're busy. Only the last one of a consecutive run matters, so skip ahead to it.
+    //All elevated actions share the same message ID, so this stops at the first queued action of any other kind and keeps everything in order
+    LPARAM pos = msg.lParam;
+    MSG msg_next;
+
+    //PM_QS_POSTMESSAGE keeps sent messages (WM_COPYDATA) from being dispatched in here, as their handling would process the queue out of order
+    while ( (::PeekMessage(&msg_next, nullptr, msg.message, msg.message, PM_NOREMOVE | PM_QS_POSTMESSAGE)) && (msg_next.wParam == msg.wParam) )
+    {
+        ::PeekMessage(&msg_next, nullptr, msg.message, msg.message, PM_REMOVE | PM_QS_POSTMESSAGE);
+        pos = msg_next.lParam;
+    }
+
+    return pos;
+}
+
+float CoalesceQueuedWheelMessages(const MSG& msg)
+{
+    //Same as above for laser pointer scrolling, but wheel deltas add up so the run is sent as a single wheel input
+    float delta = pun_cast<float, LPARAM>(msg.lParam);
+    MSG msg_next;
+
+    while ( (::PeekMessage(&msg_next, nullptr, msg.message, msg.message, PM_NOREMOVE | PM_QS_POSTMESSAGE)) && (msg_next.wParam == msg.wParam) )
+    {
+        ::PeekMessage(&msg_next, nullptr, msg.message, msg.message, PM_REMOVE | PM_QS_POSTMESSAGE);
+        delta += pun_cast<float, LPARAM>(msg_next.lParam);
+    }
+
+    return delta;
+}
@@ -146,6 +146,29 @@ bool InputSimulator::SetEventForKeyCode(INPUT& input_event, unsigned char keycod
     return true;
 }
 
+bool InputSimulator::IsKeyboardTextSplitPoint(size_t index) const
+{
+    if (index >= m_KeyboardTextQueue.size())
+        return true;
+
+    const KEYBDINPUT& ki      = m_KeyboardTextQueue[index].ki;
+    const KEYBDINPUT& ki_prev = m_KeyboardTextQueue[index - 1].ki;
+
+    //Key up belongs to the key down before it
+    if (ki.dwFlags & KEYEVENTF_KEYUP)
+        return false;
+
+    //Low surrogate belongs to the high surrogate before it
+    if ( (ki.dwFlags & KEYEVENTF_UNICODE) && (IS_LOW_SURROGATE(ki.wScan)) )
+        return false;
+
+    //Held shift belongs to the upper case letter after it
+    if ( (ki_prev.wVk == VK_SHIFT) && ((ki_prev.dwFlags & KEYEVENTF_KEYUP) == 0) )
+        return false;
+
+    return true;
+}
+
 void InputSimulator::LoadPenFunctions()
 {
     HMODULE h_user32 = ::LoadLibraryW(L"user32.dll");
@@ -191,6 +214,8 @@ void InputSimulator::MouseMove(int x, int y)
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event = { 0 };
 
     input_event.type       = INPUT_MOUSE;
@@ -224,6 +249,8 @@ void InputSimulator::MouseWheelHorizontal(float delta)
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event = {0};
 
     input_event.type         = INPUT_MOUSE;
@@ -241,6 +268,8 @@ void InputSimulator::MouseWheelVertical(float delta)
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event = {0};
 
     input_event.type         = INPUT_MOUSE;
@@ -261,6 +290,8 @@ void InputSimulator::PenMove(int x, int y)
         return;
     }
 
+    KeyboardTextFlush();
+
     CreatePenDeviceIfNeeded();
 
     m_PenState.penInfo.pointerInfo.pointerFlags |= POINTER_FLAG_INRANGE | POINTER_FLAG_UPDATE;
@@ -283,6 +314,8 @@ void InputSimulator::PenSetPrimaryDown(bool down)
         return;
     }
 
+    KeyboardTextFlush();
+
     CreatePenDeviceIfNeeded();
 
     if (down)
@@ -316,6 +349,8 @@ void InputSimulator::PenSetSecondaryDown(bool down)
         return;
     }
 
+    KeyboardTextFlush();
+
     CreatePenDeviceIfNeeded();
 
     if (down)
@@ -351,6 +386,8 @@ void InputSimulator::PenLeave()
         return;
     }
 
+    KeyboardTextFlush();
+
     CreatePenDeviceIfNeeded();
 
     if (m_PenState.penInfo.pointerInfo.pointerFlags & POINTER_FLAG_INRANGE)
@@ -377,6 +414,8 @@ void InputSimulator::KeyboardSetDown(unsigned char keycode)
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event = {0};
 
     if (SetEventForKeyCode(input_event, keycode, true))
@@ -404,6 +443,8 @@ void InputSimulator::KeyboardSetUp(unsigned char keycode)
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event = {0};
 
     if (SetEventForKeyCode(input_event, keycode, false))
@@ -424,6 +465,8 @@ void InputSimulator::KeyboardSetDown(unsigned char keycodes[3])
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event[3] = { 0 };
 
     int used_event_count = 0;
@@ -449,6 +492,8 @@ void InputSimulator::KeyboardSetUp(unsigned char keycodes[3])
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event[3] = { 0 };
 
     int used_event_count = 0;
@@ -478,6 +523,8 @@ void InputSimulator::KeyboardToggleState(unsigned char keycode)
         return;
     }
 
+    KeyboardTextFlush();
+
     if (IsKeyDown(keycode))  //If already pressed, release key
     {
         KeyboardSetUp(keycode);
@@ -499,6 +546,8 @@ void InputSimulator::KeyboardToggleState(unsigned char keycodes[3])
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event[3] = {0};
     int used_event_count = 0;
 
@@ -524,6 +573,8 @@ void InputSimulator::KeyboardPressAndRelease(unsigned char keycode)
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event[2] = {0};
     int used_event_count = 0;
 
@@ -544,6 +595,8 @@ void InputSimulator::KeyboardSetToggleKey(unsigned char keycode, bool toggled)
         return;
     }
 
+    KeyboardTextFlush();
+
     bool is_toggled = ((::GetKeyState(keycode) & 0x0001) != 0);
 
     if (toggled == is_toggled)
@@ -561,6 +614,9 @@ void InputSimulator::KeyboardSetToggleKey(unsigned char keycode, bool toggled)
 
 void InputSimulator::KeyboardSetFromWin32KeyState(unsigned short keystate, bool down)
 {
+    //Flush before checking key state as pending text can still change it. Nothing is pending here when forwarding
+    KeyboardTextFlush();
+
     unsigned char keycode  = LOBYTE(keystate);
     bool key_down = IsKeyDown(keycode);
 
@@ -648,6 +704,8 @@ void InputSimulator::KeyboardSetKeyState(IPCKeyboardKeystateFlags flags, unsigne
         return;
     }
 
+    KeyboardTextFlush();
+
     INPUT input_event[10] = {0};
     int used_event_count = 0;
 
@@ -715,6 +773,13 @@ void InputSimulator::KeyboardText(const char* str_utf8, bool always_use_unicode_
     //Convert to UTF16
     std::wstring wstr = WStringConvertFromUTF8(str_utf8);
 
+    //Reserve for the worst case of 4 events per character + capslock/shift reset, growing geometrically as this is also called per character while text is pending
+    const size_t queue_size_max = m_KeyboardTextQueue.size() + (wstr.size() * 4) + 3;
+    if (queue_size_max > m_KeyboardTextQueue.capacity())
+    {
+        m_KeyboardTextQueue.reserve(std::max(queue_size_max, m_KeyboardTextQueue.capacity() * 2));
+    }
+
     INPUT input_event = { 0 };
     input_event.type = INPUT_KEYBOARD;
 
@@ -821,25 +886,58 @@ void InputSimulator::KeyboardText(const char* str_utf8, bool always_use_unicode_
     }
 }
 
-void InputSimulator::KeyboardTextFinish()
+bool InputSimulator::KeyboardTextFinish()
 {
     if (m_ForwardToElevatedModeProcess)
     {
-        //Only send if we know there is queued text in that process
+        //Only send if we know there is queued text in that process, which then takes care of sending the remaining chunks itself
         if (m_ElevatedModeHasTextQueued)
         {
             IPCManager::Get().PostMessageToElevatedModeProcess(ipcmsg_elevated_action, ipceact_keyboard_text_finish);
             m_ElevatedModeHasTextQueued = false;
         }
-        return;
+        return false;
     }
 
-    if (!m_KeyboardTextQueue.empty())
+    if (m_KeyboardTextQueueSendPos < m_KeyboardTextQueue.size())
     {
-        ::SendInput((UINT)m_KeyboardTextQueue.size(), m_KeyboardTextQueue.data(), sizeof(INPUT));
+        //Send a single chunk, extended so it doesn't end in the middle of a character. The rest is sent on the following calls
+        size_t chunk_end = std::min(m_KeyboardTextQueueSendPos + KEYBOARD_TEXT_CHUNK_SIZE, m_KeyboardTextQueue.size());
+
+        while (!IsKeyboardTextSplitPoint(chunk_end))
+        {
+            ++chunk_end;
+        }
+
+        ::SendInput((UINT)(chunk_end - m_KeyboardTextQueueSendPos), &m_KeyboardTextQueue[m_KeyboardTextQueueSendPos], sizeof(INPUT));
 
-        m_KeyboardTextQueue.clear();
+        m_KeyboardTextQueueSendPos = chunk_end;
     }
+
+    if (m_KeyboardTextQueueSendPos < m_KeyboardTextQueue.size())
+        return true;
+
+    //Keep the buffer around for the next text unless it was grown by something unusually long
+    m_KeyboardTextQueue.clear();
+    m_KeyboardTextQueueSendPos = 0;
+
+    if (m_KeyboardTextQueue.capacity() > KEYBOARD_TEXT_CHUNK_SIZE * 16)
+    {
+        m_KeyboardTextQueue.shrink_to_fit();
+    }
+
+    return false;
+}
+
+bool InputSimulator::IsKeyboardTextPending() const
+{
+    return ( (m_ElevatedModeHasTextQueued) || (m_KeyboardTextQueueSendPos < m_KeyboardTextQueue.size()) );
+}
+
+void InputSimulator::KeyboardTextFlush()
+{
+    //Send the remaining chunks without pausing so direct key, mouse or pen input doesn't overtake text that's still pending
+    while (KeyboardTextFinish()) {}
 }
 
 void InputSimulator::SetElevatedModeForwardingActive(bool do_forward)
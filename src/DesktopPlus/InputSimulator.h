@@ -10,6 +10,10 @@
 #define Button_Dashboard_GoHome vr::k_EButton_IndexController_A
 #define Button_Dashboard_GoBack vr::k_EButton_IndexController_B
 
+//Queued text input is sent in chunks of this many input events with a pause in-between so target applications don't drop any of it
+#define KEYBOARD_TEXT_CHUNK_SIZE 256
+#define KEYBOARD_TEXT_CHUNK_DELAY_MS 10
+
 enum IPCKeyboardKeystateFlags : unsigned char;
 
 //SyntheticPointer functions are loaded manually to not require OS support to run the application (Windows 10 1809+ should have them though)
@@ -40,6 +44,7 @@ class InputSimulator
         POINTER_TYPE_INFO m_PenState = {0};
 
         std::vector<INPUT> m_KeyboardTextQueue;
+        size_t m_KeyboardTextQueueSendPos   = 0;
         bool m_ForwardToElevatedModeProcess = false;
         bool m_ElevatedModeHasTextQueued    = false;
 
@@ -49,6 +54,10 @@ class InputSimulator
         static void SetEventForMouseKeyCode(INPUT& input_event, unsigned char keycode, bool down);
         //Set the event if it would change key state. Returns if anything was written to input_event
         static bool SetEventForKeyCode(INPUT& input_event, unsigned char keycode, bool down, bool skip_check = false);
+        //Returns if a chunk of queued text can end before the event at index without splitting up a character's events
+        bool IsKeyboardTextSplitPoint(size_t index) const;
+        //Sends all remaining queued text right away. Called before any direct input to keep it in order with the text
+        void KeyboardTextFlush();
 
     public:
         InputSimulator();
@@ -79,7 +88,8 @@ class InputSimulator
         void KeyboardSetFromWin32KeyState(unsigned short keystate, bool down);          //Keystate as returned by VkKeyScan()
         void KeyboardSetKeyState(IPCKeyboardKeystateFlags flags, unsigned char keycode);
         void KeyboardText(const char* str_utf8, bool always_use_unicode_event = false);
-        void KeyboardTextFinish();
+        bool KeyboardTextFinish();                                                       //Sends the next chunk of queued text. Returns true if there's more left to send
+        bool IsKeyboardTextPending() const;
 
         void SetElevatedModeForwardingActive(bool do_forward);
 
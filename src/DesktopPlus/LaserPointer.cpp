@@ -8,6 +8,7 @@
 
 #define LASER_POINTER_OVERLAY_WIDTH 0.0025f
 #define LASER_POINTER_DEFAULT_LENGTH 5.0f
+#define UI_INTERSECTION_MASK_CELL_SIZE 64
 
 LaserPointer::LaserPointer() : m_ActivationOrigin(dplp_activation_origin_none), 
                                m_HadPrimaryPointerDevice(false), 
@@ -16,7 +17,9 @@ LaserPointer::LaserPointer() : m_ActivationOrigin(dplp_activation_origin_none),
                                m_LastScrollTick(0),
                                m_DeviceHapticPending(vr::k_unTrackedDeviceIndexInvalid),
                                m_IsForceTargetOverlayActive(false),
-                               m_ForceTargetOverlayHandle(vr::k_ulOverlayHandleInvalid)
+                               m_ForceTargetOverlayHandle(vr::k_ulOverlayHandleInvalid),
+                               m_UIIntersectionMaskGridWidth(0),
+                               m_UIIntersectionMaskGridHeight(0)
 {
     //Not calling Update() here since the OutputManager typically needs to load the config and OpenVR first
 }
@@ -931,11 +934,12 @@ vr::TrackedDeviceIndex_t LaserPointer::IsAnyOverlayHovered(float max_distance) c
 
                 if ( (data.ConfigInt[configid_int_overlay_origin] != origin_avoid) && (overlay.IsVisible()) && (data.ConfigBool[configid_bool_overlay_input_dplus_lp_enabled]) )
                 {
-                    //Check if input is enabled right now (could differ from config setting)
-                    vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
-                    vr::VROverlay()->GetOverlayInputMethod(overlay.GetHandle(), &input_method);
+                    //Skip overlays that can't be in reach without asking the runtime. This is called every frame, so most overlays should be out by here
+                    if (overlay.IsOutOfReach(params.vSource, max_distance))
+                        continue;
 
-                    if ( (input_method == vr::VROverlayInputMethod_Mouse) && 
+                    //Check if input is enabled right now (could differ from config setting)
+                    if ( (overlay.GetInputMethod() == vr::VROverlayInputMethod_Mouse) && 
                          (vr::VROverlay()->ComputeOverlayIntersection(overlay.GetHandle(), &params, &results)) && (results.fDistance <= max_distance) )
                     {
                         if ( (vr::IVROverlayEx::IsOverlayIntersectionHitFrontFacing(params, results)) && (IntersectionMaskHitTest(overlay.GetTextureSource(), results.vUVs)) )
@@ -1009,9 +1013,16 @@ bool LaserPointer::IntersectionMaskHitTest(OverlayTextureSource texsource, vr::H
     {
         Vector2Int point(int(uv.v[0] * m_UIMouseScale.x), int((-uv.v[1] + 1.0f) * m_UIMouseScale.y));
 
-        for (const auto& rect : m_UIIntersectionMaskRects)
+        if ( (m_UIIntersectionMaskGridWidth == 0) || (!m_UIIntersectionMaskBounds.Contains(point)) )
+            return false;
+
+        //Only check the rects overlapping the cell the point is in
+        const int cell = ((point.y - m_UIIntersectionMaskBounds.Min.y) / UI_INTERSECTION_MASK_CELL_SIZE) * m_UIIntersectionMaskGridWidth + 
+                          (point.x - m_UIIntersectionMaskBounds.Min.x) / UI_INTERSECTION_MASK_CELL_SIZE;
+
+        for (unsigned int i = m_UIIntersectionMaskCellOffsets[cell]; i < m_UIIntersectionMaskCellOffsets[cell + 1]; ++i)
         {
-            if (rect.Contains(point))
+            if (m_UIIntersectionMaskRects[m_UIIntersectionMaskCellRects[i]].Contains(point))
             {
                 return true;
             }
@@ -1031,6 +1042,95 @@ void LaserPointer::UIIntersectionMaskAddRect(DPRect& rect)
 
 void LaserPointer::UIIntersectionMaskFinish()
 {
-    m_UIIntersectionMaskRects = m_UIIntersectionMaskRectsPending;
+    m_UIIntersectionMaskRects.swap(m_UIIntersectionMaskRectsPending);
     m_UIIntersectionMaskRectsPending.clear();
+
+    UIIntersectionMaskBuildGrid();
+}
+
+void LaserPointer::UIIntersectionMaskBuildGrid()
+{
+    m_UIIntersectionMaskGridWidth  = 0;
+    m_UIIntersectionMaskGridHeight = 0;
+    m_UIIntersectionMaskCellOffsets.clear();
+    m_UIIntersectionMaskCellRects.clear();
+
+    //Get bounds of all non-empty rects, points outside of them can't hit anything
+    bool has_bounds = false;
+    for (const auto& rect : m_UIIntersectionMaskRects)
+    {
+        if ( (rect.GetWidth() <= 0) || (rect.GetHeight() <= 0) )
+            continue;
+
+        if (has_bounds)
+        {
+            m_UIIntersectionMaskBounds.Min.x = std::min(m_UIIntersectionMaskBounds.Min.x, rect.Min.x);
+            m_UIIntersectionMaskBounds.Min.y = std::min(m_UIIntersectionMaskBounds.Min.y, rect.Min.y);
+            m_UIIntersectionMaskBounds.Max.x = std::max(m_UIIntersectionMaskBounds.Max.x, rect.Max.x);
+            m_UIIntersectionMaskBounds.Max.y = std::max(m_UIIntersectionMaskBounds.Max.y, rect.Max.y);
+        }
+        else
+        {
+            m_UIIntersectionMaskBounds = rect;
+            has_bounds = true;
+        }
+    }
+
+    if (!has_bounds)
+        return;
+
+    const int grid_width  = (m_UIIntersectionMaskBounds.GetWidth()  + UI_INTERSECTION_MASK_CELL_SIZE - 1) / UI_INTERSECTION_MASK_CELL_SIZE;
+    const int grid_height = (m_UIIntersectionMaskBounds.GetHeight() + UI_INTERSECTION_MASK_CELL_SIZE - 1) / UI_INTERSECTION_MASK_CELL_SIZE;
+
+    //Count entries per cell first, turn the counts into end offsets, then fill in the entries while moving the offsets back to their starts
+    m_UIIntersectionMaskCellOffsets.resize((grid_width * grid_height) + 1, 0);
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int rect_id = 0; rect_id < (unsigned int)m_UIIntersectionMaskRects.size(); ++rect_id)
+        {
+            const DPRect& rect = m_UIIntersectionMaskRects[rect_id];
+
+            if ( (rect.GetWidth() <= 0) || (rect.GetHeight() <= 0) )
+                continue;
+
+            const int cell_x_min = (rect.Min.x     - m_UIIntersectionMaskBounds.Min.x) / UI_INTERSECTION_MASK_CELL_SIZE;
+            const int cell_y_min = (rect.Min.y     - m_UIIntersectionMaskBounds.Min.y) / UI_INTERSECTION_MASK_CELL_SIZE;
+            const int cell_x_max = (rect.Max.x - 1 - m_UIIntersectionMaskBounds.Min.x) / UI_INTERSECTION_MASK_CELL_SIZE;
+            const int cell_y_max = (rect.Max.y - 1 - m_UIIntersectionMaskBounds.Min.y) / UI_INTERSECTION_MASK_CELL_SIZE;
+
+            for (int y = cell_y_min; y <= cell_y_max; ++y)
+            {
+                for (int x = cell_x_min; x <= cell_x_max; ++x)
+                {
+                    const int cell = (y * grid_width) + x;
+
+                    if (pass == 0)
+                    {
+                        m_UIIntersectionMaskCellOffsets[cell]++;
+                    }
+                    else
+                    {
+                        m_UIIntersectionMaskCellRects[--m_UIIntersectionMaskCellOffsets[cell]] = rect_id;
+                    }
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            unsigned int offset = 0;
+            for (int cell = 0; cell < grid_width * grid_height; ++cell)
+            {
+                offset += m_UIIntersectionMaskCellOffsets[cell];
+                m_UIIntersectionMaskCellOffsets[cell] = offset;
+            }
+
+            m_UIIntersectionMaskCellOffsets.back() = offset;
+            m_UIIntersectionMaskCellRects.resize(offset);
+        }
+    }
+
+    m_UIIntersectionMaskGridWidth  = grid_width;
+    m_UIIntersectionMaskGridHeight = grid_height;
 }
@@ -56,11 +56,19 @@ class LaserPointer
         std::vector<DPRect> m_UIIntersectionMaskRects;
         std::vector<DPRect> m_UIIntersectionMaskRectsPending;
 
+        //Coarse grid over the bounds of the UI intersection mask, built by UIIntersectionMaskFinish(). Each cell lists the mask rects overlapping it
+        DPRect m_UIIntersectionMaskBounds;
+        int m_UIIntersectionMaskGridWidth;
+        int m_UIIntersectionMaskGridHeight;
+        std::vector<unsigned int> m_UIIntersectionMaskCellOffsets;  //Start of each cell's entries in m_UIIntersectionMaskCellRects, with the total count at the end
+        std::vector<unsigned int> m_UIIntersectionMaskCellRects;    //Indices into m_UIIntersectionMaskRects
+
         void CreateDeviceOverlay(vr::TrackedDeviceIndex_t device_index);
         void UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index);
         void UpdateIntersection(vr::TrackedDeviceIndex_t device_index);
 
         void SendDirectDragCommand(vr::VROverlayHandle_t overlay_handle_target, bool do_start_drag);
+        void UIIntersectionMaskBuildGrid();
 
     public:
         LaserPointer();
@@ -25,6 +25,8 @@ using namespace DirectX;
 #include "DesktopPlusWinRT.h"
 #include "DPBrowserAPIClient.h"
 
+#define GAZE_FADE_ALPHA_STEP_MIN 0.005f     //Smallest gaze fade alpha change that is applied to the overlay, excluding fully hidden/visible states
+
 static OutputManager* g_OutputManager; //May not always exist, but there also should never be two, so this is fine
 
 OutputManager* OutputManager::Get()
@@ -64,6 +66,7 @@ OutputManager::OutputManager(HANDLE PauseDuplicationEvent, HANDLE ResumeDuplicat
     m_DesktopWidth(-1),
     m_DesktopHeight(-1),
     m_MaxActiveRefreshDelay(16),
+    m_HMDFramePeriod(16.0f),
     m_OutputPendingSkippedFrame(false),
     m_OutputPendingFullRefresh(false),
     m_OutputHDRAvailable(false),
@@ -662,7 +665,8 @@ std::tuple<vr::EVRInitError, vr::EVROverlayError, bool> OutputManager::InitOverl
         }
     }
 
-    m_MaxActiveRefreshDelay = 1000.0f / GetHMDFrameRate();
+    m_HMDFramePeriod        = 1000.0f / GetHMDFrameRate();
+    m_MaxActiveRefreshDelay = m_HMDFramePeriod;
 
     //Check if this process was launched by Steam by checking if the "SteamClientLaunch" environment variable exists
     bool is_steam_app = (::GetEnvironmentVariable(L"SteamClientLaunch", nullptr, 0) != 0);
@@ -940,6 +944,9 @@ void OutputManager::BusyUpdate()
 
 bool OutputManager::HandleIPCMessage(const MSG& msg)
 {
+    //Opt-in trace of all received messages with handler duration, enabled by launching with verbosity 2 or higher (-v 2)
+    DPLog_IPCMessageTrace ipc_trace(IPCManager::Get().GetIPCMessageID(msg.message), msg.message, msg.wParam, msg.lParam);
+
     //Handle messages sent by browser process in the APIClient
     if (msg.message == DPBrowserAPIClient::Get().GetRegisteredMessageID())
     {
@@ -1274,6 +1281,7 @@ bool OutputManager::HandleIPCMessage(const MSG& msg)
                 case ipcact_sync_config_state:
                 {
                     //Overlay state
+                    //The override is switched straight to the next overlay and only disabled after the last one, as there's nothing in-between that would need it off
                     for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
                     {
                         const Overlay& overlay        = OverlayManager::Get().GetOverlay(i);
@@ -1299,7 +1307,10 @@ bool OutputManager::HandleIPCMessage(const MSG& msg)
                         }
 
                         IPCManager::Get().PostConfigMessageToUIApp(configid_float_overlay_state_brightness_extra_multiplier, data.ConfigFloat[configid_float_overlay_state_brightness_extra_multiplier]);
+                    }
 
+                    if (OverlayManager::Get().GetOverlayCount() != 0)
+                    {
                         IPCManager::Get().PostConfigMessageToUIApp(configid_int_state_overlay_current_id_override, -1);
                     }
 
@@ -1815,6 +1826,14 @@ bool OutputManager::HandleIPCMessage(const MSG& msg)
             {
                 ConfigID_Float float_id = (ConfigID_Float)(msg.wParam - configid_bool_MAX - configid_int_MAX);
 
+                //Sliders in the UI send a value every frame, which can queue up while we're busy. Skip this one if the next queued message replaces it anyways
+                //Float settings don't depend on their previous value and nothing else is in-between, so this doesn't change the outcome
+                MSG msg_next;
+                if ( (::PeekMessage(&msg_next, nullptr, 0, 0, PM_NOREMOVE | PM_QS_POSTMESSAGE)) && (msg_next.message == msg.message) && (msg_next.wParam == msg.wParam) )
+                {
+                    break;
+                }
+
                 float value = pun_cast<float, LPARAM>(msg.lParam);
                 float previous_value = ConfigManager::GetValue(float_id);
                 ConfigManager::SetValue(float_id, value);
@@ -2195,6 +2214,12 @@ bool OutputManager::GetOverlayInputActive() const
 
 DWORD OutputManager::GetMaxRefreshDelay() const
 {
+    //Queued text input is sent in chunks on each update, so keep them coming at the intended pace
+    if (m_InputSim.IsKeyboardTextPending())
+    {
+        return KEYBOARD_TEXT_CHUNK_DELAY_MS;
+    }
+
     if ( (m_OvrlActiveCount != 0) || (m_OvrlDashboardActive) || (m_LaserPointer.IsActive()) )
     {
         //Actually causes extreme load while not really being necessary (looks nice tho)
@@ -2212,6 +2237,11 @@ DWORD OutputManager::GetMaxRefreshDelay() const
             //While input is active, especially with the HMD pointer, we need to update more frequently to allow for smooth cursor movements
             return m_MaxActiveRefreshDelay / 2;
         }
+        else if ( (m_OverlayDragger.IsDragActive()) || (m_OverlayDragger.IsDragGestureActive()) || (IsAnyOverlayUsingHMDFloorOrigin()) )
+        {
+            //Transforms following device poses are set by us, so wake up right after vsync to have the predicted poses match the frame they end up in
+            return GetTimeToNextVsync();
+        }
         else
         {
             return m_MaxActiveRefreshDelay;
@@ -4643,6 +4673,10 @@ bool OutputManager::HandleOpenVREvents()
     unsigned int current_overlay_old = OverlayManager::Get().GetCurrentOverlayID();
     for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
     {
+        //Skip overlays that can't have any events queued. Anything broadcast to them while hidden stays queued until they're visible again
+        if (!OverlayManager::Get().GetOverlay(i).IsEventPollNeeded())
+            continue;
+
         OverlayManager::Get().SetCurrentOverlayID(i);
 
         Overlay& overlay = OverlayManager::Get().GetCurrentOverlay();
@@ -4848,6 +4882,10 @@ bool OutputManager::HandleOpenVREvents()
         dashboard_origin_was_updated = true;
     }
 
+    //HMD pose for gaze fade, only queried once for all overlays and only when needed
+    vr::TrackedDevicePose_t gazefade_hmd_pose = {0};
+    bool gazefade_hmd_pose_queried = false;
+
     for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
     {
         OverlayManager::Get().SetCurrentOverlayID(i);
@@ -4880,7 +4918,19 @@ bool OutputManager::HandleOpenVREvents()
                 }
             }
 
-            DetachedOverlayGazeFade();
+            if (data.ConfigBool[configid_bool_overlay_gazefade_enabled])
+            {
+                if (!gazefade_hmd_pose_queried)
+                {
+                    vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
+                    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+
+                    gazefade_hmd_pose = poses[vr::k_unTrackedDeviceIndex_Hmd];
+                    gazefade_hmd_pose_queried = true;
+                }
+
+                DetachedOverlayGazeFade(gazefade_hmd_pose);
+            }
         }
     }
 
@@ -4929,6 +4979,9 @@ bool OutputManager::HandleOpenVREvents()
 
     FinishQueuedOverlayRemovals();
 
+    //Send out browser mouse input collected during this update
+    DPBrowserAPIClient::Get().FlushPendingInput();
+
     return false;
 }
 
@@ -5166,11 +5219,11 @@ void OutputManager::OnOpenVRMouseEvent(const vr::VREvent_t& vr_event, unsigned i
                         //Set flag for all overlays
                         for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
                         {
-                            const Overlay& overlay = OverlayManager::Get().GetOverlay(i);
+                            Overlay& overlay = OverlayManager::Get().GetOverlay(i);
 
                             if ( (overlay.GetTextureSource() != ovrl_texsource_none) && (overlay.GetTextureSource() != ovrl_texsource_ui) && (overlay.GetTextureSource() != ovrl_texsource_browser) )
                             {
-                                vr::VROverlay()->SetOverlayFlag(overlay.GetHandle(), vr::VROverlayFlags_HideLaserIntersection, true);
+                                overlay.SetFlag(vr::VROverlayFlags_HideLaserIntersection, true);
                             }
                         }
                     }
@@ -6027,7 +6080,7 @@ void OutputManager::ApplySettingCaptureSource()
 
 void OutputManager::ApplySetting3DMode()
 {
-    const Overlay& overlay_current = OverlayManager::Get().GetCurrentOverlay();
+    Overlay& overlay_current = OverlayManager::Get().GetCurrentOverlay();
     const OverlayConfigData& data = OverlayManager::Get().GetCurrentConfigData();
 
     vr::VROverlayHandle_t ovrl_handle = overlay_current.GetHandle();
@@ -6044,13 +6097,13 @@ void OutputManager::ApplySetting3DMode()
     {
         if (data.ConfigBool[configid_bool_overlay_3D_swapped])
         {
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, true);
+            overlay_current.SetFlag(vr::VROverlayFlags_SideBySide_Parallel, false);
+            overlay_current.SetFlag(vr::VROverlayFlags_SideBySide_Crossed,  true);
         }
         else
         {
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, true);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, false);
+            overlay_current.SetFlag(vr::VROverlayFlags_SideBySide_Parallel, true);
+            overlay_current.SetFlag(vr::VROverlayFlags_SideBySide_Crossed,  false);
         }
 
         switch (mode)
@@ -6076,8 +6129,8 @@ void OutputManager::ApplySetting3DMode()
     }
     else
     {
-        vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
-        vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, false);
+        overlay_current.SetFlag(vr::VROverlayFlags_SideBySide_Parallel, false);
+        overlay_current.SetFlag(vr::VROverlayFlags_SideBySide_Crossed,  false);
         vr::VROverlay()->SetOverlayTexelAspect(ovrl_handle, 1.0f);
     }
 
@@ -6105,8 +6158,6 @@ void OutputManager::ApplySettingTransform()
     Overlay& overlay = OverlayManager::Get().GetCurrentOverlay();
     const OverlayConfigData& data = OverlayManager::Get().GetCurrentConfigData();
 
-    vr::VROverlayHandle_t ovrl_handle = overlay.GetHandle();
-
     //Fixup overlay visibility if needed
     //This has to be done first since there seem to be issues with moving invisible overlays
     bool should_be_visible = overlay.ShouldBeVisible();
@@ -6200,7 +6251,7 @@ void OutputManager::ApplySettingTransform()
                                                                         ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                         ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-            vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+            overlay.SetTransformAbsolute(universe_origin, matrix);
             break;
         }
         case ovrl_origin_hmd_floor:
@@ -6218,7 +6269,7 @@ void OutputManager::ApplySettingTransform()
                                            ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
             matrix = matrix_base.toOpenVR34();
-            vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, vr::TrackingUniverseStanding, &matrix);
+            overlay.SetTransformAbsolute(vr::TrackingUniverseStanding, matrix);
             break;
         }
         case ovrl_origin_dashboard:
@@ -6240,7 +6291,7 @@ void OutputManager::ApplySettingTransform()
 
             matrix = matrix_base.toOpenVR34();
 
-            vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+            overlay.SetTransformAbsolute(universe_origin, matrix);
             break;
         }
         case ovrl_origin_hmd:
@@ -6252,7 +6303,7 @@ void OutputManager::ApplySettingTransform()
                                                                         ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                         ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-            vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, vr::k_unTrackedDeviceIndex_Hmd, &matrix);
+            overlay.SetTransformTrackedDeviceRelative(vr::k_unTrackedDeviceIndex_Hmd, matrix);
             break;
         }
         case ovrl_origin_right_hand:
@@ -6268,11 +6319,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, device_index, &matrix);
+                overlay.SetTransformTrackedDeviceRelative(device_index, matrix);
             }
             else //No controller connected, uh put it to 0?
             {
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+                overlay.SetTransformAbsolute(universe_origin, matrix);
             }
             break;
         }
@@ -6289,11 +6340,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, device_index, &matrix);
+                overlay.SetTransformTrackedDeviceRelative(device_index, matrix);
             }
             else //No controller connected, uh put it to 0?
             {
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+                overlay.SetTransformAbsolute(universe_origin, matrix);
             }
             break;
         }
@@ -6310,11 +6361,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, index_tracker, &matrix);
+                overlay.SetTransformTrackedDeviceRelative(index_tracker, matrix);
             }
             else //Not connected, uh put it to 0?
             {
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+                overlay.SetTransformAbsolute(universe_origin, matrix);
             }
 
             break;
@@ -6322,15 +6373,15 @@ void OutputManager::ApplySettingTransform()
     }
 
     //Update Width
-    vr::VROverlay()->SetOverlayWidthInMeters(ovrl_handle, width);
+    overlay.SetWidth(width);
 
     //Update Curvature
-    vr::VROverlay()->SetOverlayCurvature(ovrl_handle, ConfigManager::GetValue(configid_float_overlay_curvature));
+    overlay.SetCurvature(ConfigManager::GetValue(configid_float_overlay_curvature));
 
     //Update Brightness
     //We use the logarithmic counterpart since the changes in higher steps are barely visible while the lower range can really use those additional steps
     float brightness = lin2log(ConfigManager::GetValue(configid_float_overlay_brightness)) * ConfigManager::GetValue(configid_float_overlay_state_brightness_extra_multiplier);
-    vr::VROverlay()->SetOverlayColor(ovrl_handle, brightness, brightness, brightness);
+    overlay.SetBrightness(brightness);
 
     //Set last tick for dashboard dummy delayed update
     m_LastApplyTransformTick = ::GetTickCount64();
@@ -6360,7 +6411,7 @@ void OutputManager::ApplySettingCrop()
         tex_bounds.uMax = 1.0f;
         tex_bounds.vMax = 1.0f;
 
-        vr::VROverlay()->SetOverlayTextureBounds(ovrl_handle, &tex_bounds);
+        overlay.SetTextureBounds(tex_bounds);
         return;
     }
 
@@ -6411,7 +6462,7 @@ void OutputManager::ApplySettingCrop()
         }
     }
 
-    vr::VROverlay()->SetOverlayTextureBounds(ovrl_handle, &tex_bounds);
+    overlay.SetTextureBounds(tex_bounds);
 }
 
 void OutputManager::ApplySettingInputMode()
@@ -6426,24 +6477,23 @@ void OutputManager::ApplySettingInputMode()
     {
         OverlayManager::Get().SetCurrentOverlayID(i);
 
-        const Overlay& overlay_current = OverlayManager::Get().GetCurrentOverlay();
-        vr::VROverlayHandle_t ovrl_handle = overlay_current.GetHandle();
+        Overlay& overlay = OverlayManager::Get().GetCurrentOverlay();
 
         if ((ConfigManager::GetValue(configid_bool_overlay_input_enabled)) || (drag_or_select_mode_enabled) )
         {
             //Don't activate drag mode for HMD origin when the pointer is also the HMD (or it's the dashboard overlay)
             if ( ((ConfigManager::Get().GetPrimaryLaserPointerDevice() == vr::k_unTrackedDeviceIndex_Hmd) && (ConfigManager::GetValue(configid_int_overlay_origin) == ovrl_origin_hmd)) )
             {
-                vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
+                overlay.SetInputMethod(vr::VROverlayInputMethod_None);
             }
             else
             {
-                vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_Mouse);
+                overlay.SetInputMethod(vr::VROverlayInputMethod_Mouse);
             }
         }
         else
         {
-            vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
+            overlay.SetInputMethod(vr::VROverlayInputMethod_None);
         }
 
         //Sync matrix if it's been turned off
@@ -6488,20 +6538,20 @@ void OutputManager::ApplySettingMouseInput()
             //Temp drag needs every input-enabled overlay to have smooth scroll
             if ( (ConfigManager::GetValue(configid_bool_input_mouse_scroll_smooth)) || (ConfigManager::GetValue(configid_bool_state_overlay_dragmode_temp)) || (drag_mode_enabled) )
             {
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, false);
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRSmoothScrollEvents,   true);
+                overlay.SetFlag(vr::VROverlayFlags_SendVRDiscreteScrollEvents, false);
+                overlay.SetFlag(vr::VROverlayFlags_SendVRSmoothScrollEvents,   true);
             }
             else
             {
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, true);
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRSmoothScrollEvents,   false);
+                overlay.SetFlag(vr::VROverlayFlags_SendVRDiscreteScrollEvents, true);
+                overlay.SetFlag(vr::VROverlayFlags_SendVRSmoothScrollEvents,   false);
             }
 
-            vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_Mouse);
+            overlay.SetInputMethod(vr::VROverlayInputMethod_Mouse);
         }
         else
         {
-            vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
+            overlay.SetInputMethod(vr::VROverlayInputMethod_None);
         }
 
         //Set intersection blob state
@@ -6517,7 +6567,7 @@ void OutputManager::ApplySettingMouseInput()
             hide_intersection = !ConfigManager::GetValue(configid_bool_input_mouse_render_intersection_blob);
         }
 
-        vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_HideLaserIntersection, hide_intersection);
+        overlay.SetFlag(vr::VROverlayFlags_HideLaserIntersection, hide_intersection);
 
         ApplySettingMouseScale();
 
@@ -6628,7 +6678,7 @@ void OutputManager::ApplySettingMouseScale()
         }
     }
 
-    vr::VROverlay()->SetOverlayMouseScale(ovrl_handle, &mouse_scale);
+    overlay.SetMouseScale(mouse_scale);
 }
 
 void OutputManager::ApplySettingUpdateLimiter()
@@ -7157,8 +7207,7 @@ void OutputManager::DetachedTransformUpdateHMDFloor()
                               ConfigManager::GetValue(configid_float_overlay_offset_up),
                               ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-    vr::HmdMatrix34_t matrix_ovr = matrix.toOpenVR34();
-    vr::VROverlay()->SetOverlayTransformAbsolute(OverlayManager::Get().GetCurrentOverlay().GetHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+    OverlayManager::Get().GetCurrentOverlay().SetTransformAbsolute(vr::TrackingUniverseStanding, matrix.toOpenVR34());
 }
 
 void OutputManager::DetachedTransformUpdateSeatedPosition()
@@ -7225,7 +7274,7 @@ void OutputManager::DetachedInteractionAutoToggleAll()
     }
 }
 
-void OutputManager::DetachedOverlayGazeFade()
+void OutputManager::DetachedOverlayGazeFade(const vr::TrackedDevicePose_t& hmd_pose)
 {
     if (ConfigManager::GetValue(configid_bool_overlay_gazefade_enabled))
     {
@@ -7238,18 +7287,14 @@ void OutputManager::DetachedOverlayGazeFade()
 
         if ((!ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) && (!ConfigManager::GetValue(configid_bool_state_overlay_selectmode)))
         {
-            vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
-            vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-            vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
-
-            if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
+            if (hmd_pose.bPoseIsValid)
             {
                 //Distance the gaze point is offset from HMD (useful range 0.25 - 1.0)
                 float gaze_distance = ConfigManager::GetValue(configid_float_overlay_gazefade_distance);
                 //Rate the fading gets applied when looking off the gaze point (useful range 4.0 - 30, depends on overlay size) 
                 float fade_rate = ConfigManager::GetValue(configid_float_overlay_gazefade_rate) * 10.0f; 
 
-                Matrix4 mat_pose = poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking;
+                Matrix4 mat_pose = hmd_pose.mDeviceToAbsoluteTracking;
 
                 Matrix4 mat_overlay = m_OverlayDragger.GetBaseOffsetMatrix();
                 mat_overlay *= ConfigManager::Get().GetOverlayDetachedTransform();
@@ -7297,9 +7342,17 @@ void OutputManager::DetachedOverlayGazeFade()
 
         //Limit alpha change per frame to smooth out things when abrupt changes happen (i.e. overlay capture took a bit to re-enable or laser pointer forces full alpha)
         const float prev_alpha = current_overlay.GetOpacity();
-        const float diff = alpha - prev_alpha;
+        const float diff = clamp(alpha - prev_alpha, -0.1f, 0.1f);
 
-        current_overlay.SetOpacity(prev_alpha + clamp(diff, -0.1f, 0.1f));
+        //Skip changes too small to be visible to not call into OpenVR for every overlay on every little head movement
+        //Fully hidden and fully visible are always applied exactly though, as 0% opacity hides the overlay and max opacity is expected to be reached precisely
+        const float alpha_full = std::max(min_alpha, max_alpha);
+        const float alpha_new  = prev_alpha + diff;
+
+        if ( (fabs(diff) >= GAZE_FADE_ALPHA_STEP_MIN) || (alpha_new == 0.0f) || (alpha_new == alpha_full) )
+        {
+            current_overlay.SetOpacity(alpha_new);
+        }
     }
 }
 
@@ -7639,6 +7692,35 @@ bool OutputManager::IsAnyOverlayUsingGazeFade() const
     return false;
 }
 
+bool OutputManager::IsAnyOverlayUsingHMDFloorOrigin() const
+{
+    for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
+    {
+        const OverlayConfigData& data = OverlayManager::Get().GetConfigData(i);
+
+        if ( (data.ConfigInt[configid_int_overlay_origin] == ovrl_origin_hmd_floor) && (OverlayManager::Get().GetOverlay(i).IsVisible()) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+DWORD OutputManager::GetTimeToNextVsync() const
+{
+    float seconds_since_last_vsync;
+    if ( (m_HMDFramePeriod <= 0.0f) || (!vr::VRSystem()->GetTimeSinceLastVsync(&seconds_since_last_vsync, nullptr)) )
+        return m_MaxActiveRefreshDelay;
+
+    //Wrap the phase in case vsyncs were missed. +1 since the cast truncates, so we land just after vsync instead of right before it
+    const float ms_since_vsync = fmodf(seconds_since_last_vsync * 1000.0f, m_HMDFramePeriod);
+    const float ms_to_vsync    = (m_HMDFramePeriod - ms_since_vsync) + 1.0f;
+
+    //Never return 0, which would have the main loop spin without waiting
+    return std::max((DWORD)ms_to_vsync, (DWORD)1);
+}
+
 void OutputManager::RegisterHotkeys()
 {
     //Just unregister all we have when updating any
@@ -144,7 +144,7 @@ class OutputManager
         void DetachedTransformUpdateSeatedPosition();
 
         void DetachedInteractionAutoToggleAll();
-        void DetachedOverlayGazeFade();
+        void DetachedOverlayGazeFade(const vr::TrackedDevicePose_t& hmd_pose);
         void DetachedOverlayGazeFadeAutoConfigure();
         void DetachedOverlayAutoDockingAll();
 
@@ -161,6 +161,8 @@ class OutputManager
         void DimDashboard(bool do_dim);
         void UpdatePendingDashboardDummyHeight();
         bool IsAnyOverlayUsingGazeFade() const;
+        bool IsAnyOverlayUsingHMDFloorOrigin() const;
+        DWORD GetTimeToNextVsync() const;
 
         void RegisterHotkeys();
         void HandleHotkeys();
@@ -202,6 +204,7 @@ class OutputManager
         DPRect m_DesktopRectTotal;              //Total rect of all available desktops (may not be the same as above Desktop Duplication rect if that's not using the combined desktop)
         std::vector<float> m_DesktopHDRWhiteLevelAdjustments; //Cached GetDesktopHDRWhiteLevelAdjustment() results used during cursor updates
         DWORD m_MaxActiveRefreshDelay;
+        float m_HMDFramePeriod;                 //Exact HMD frame time in ms, m_MaxActiveRefreshDelay is truncated
         bool m_OutputHDRAvailable;              //False if OS doesn't support the required interface, regardless of hardware connected
         bool m_OutputInvalid;
         bool m_OutputPendingSkippedFrame;
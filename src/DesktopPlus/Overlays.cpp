@@ -9,9 +9,12 @@
 #include "DesktopPlusWinRT.h"
 #include "DPBrowserAPIClient.h"
 
+#define OVERLAY_EVENT_POLL_HIDDEN_MS 1000
+
 Overlay::Overlay(unsigned int id) : m_ID(id),
                                     m_OvrlHandle(vr::k_ulOverlayHandleInvalid),
                                     m_Visible(false),
+                                    m_HideTick(0),
                                     m_Opacity(1.0f),
                                     m_TextureSource(ovrl_texsource_invalid)
 {
@@ -49,9 +52,11 @@ Overlay& Overlay::operator=(Overlay&& b)
         m_ID                = b.m_ID;
         m_OvrlHandle        = b.m_OvrlHandle;
         m_Visible           = b.m_Visible;
+        m_HideTick          = b.m_HideTick;
         m_Opacity           = b.m_Opacity;
         m_ValidatedCropRect = b.m_ValidatedCropRect;
         m_TextureSource     = b.m_TextureSource;
+        m_RuntimeState      = b.m_RuntimeState;
         //m_OUtoSBSConverter should just be left alone, it only holds cached state anyways
 
         b.m_OvrlHandle = vr::k_ulOverlayHandleInvalid;
@@ -98,6 +103,7 @@ void Overlay::InitOverlay()
 
     vr::VROverlayError ovrl_error = vr::VROverlayError_None;
     ovrl_error = vr::VROverlay()->CreateOverlay(key.c_str(), "Desktop+", &m_OvrlHandle);
+    InvalidateRuntimeState();
 
     if (ovrl_error == vr::VROverlayError_None)
     {
@@ -167,6 +173,10 @@ vr::VROverlayHandle_t Overlay::GetHandle() const
 void Overlay::SetHandle(vr::VROverlayHandle_t handle)
 {
     m_OvrlHandle = handle;
+    m_HideTick   = ::GetTickCount64();
+
+    //Whatever state the new handle has is unknown to us
+    InvalidateRuntimeState();
 }
 
 void Overlay::SetOpacity(float opacity)
@@ -210,6 +220,12 @@ float Overlay::GetOpacity() const
 void Overlay::SetVisible(bool visible)
 {
     m_Visible = visible;
+
+    if (!visible)
+    {
+        m_HideTick = ::GetTickCount64();
+    }
+
     (visible) ? vr::VROverlay()->ShowOverlay(m_OvrlHandle) : vr::VROverlay()->HideOverlay(m_OvrlHandle);
 }
 
@@ -218,6 +234,12 @@ bool Overlay::IsVisible() const
     return m_Visible;
 }
 
+bool Overlay::IsEventPollNeeded() const
+{
+    //Hidden overlays don't get new input, but focus leave and similar events can still arrive shortly after hiding them
+    return ( (m_Visible) || (m_HideTick + OVERLAY_EVENT_POLL_HIDDEN_MS > ::GetTickCount64()) );
+}
+
 bool Overlay::ShouldBeVisible() const
 {
     const OverlayConfigData& data = OverlayManager::Get().GetConfigData(m_ID);
@@ -370,6 +392,9 @@ void Overlay::SetTextureSource(OverlayTextureSource tex_source)
 
     m_TextureSource = tex_source;
 
+    //Other processes may have changed texture bounds, mouse scale etc. while they were responsible for the overlay, so don't trust the old state
+    InvalidateRuntimeState();
+
     switch (m_TextureSource)
     {
         case ovrl_texsource_none:
@@ -415,3 +440,166 @@ void Overlay::OnDesktopDuplicationUpdate()
         OutputManager::Get()->ConvertOUtoSBS(*this, m_OUtoSBSConverter);
     }
 }
+
+void Overlay::SetTransformAbsolute(vr::ETrackingUniverseOrigin universe_origin, const vr::HmdMatrix34_t& matrix)
+{
+    if ( (m_RuntimeState.IsTransformValid) && (m_RuntimeState.TransformDeviceIndex == vr::k_unTrackedDeviceIndexInvalid) && 
+         (m_RuntimeState.TransformUniverseOrigin == universe_origin) && (memcmp(&m_RuntimeState.Transform, &matrix, sizeof(vr::HmdMatrix34_t)) == 0) )
+    {
+        return;
+    }
+
+    vr::VROverlay()->SetOverlayTransformAbsolute(m_OvrlHandle, universe_origin, &matrix);
+
+    m_RuntimeState.IsTransformValid        = true;
+    m_RuntimeState.TransformUniverseOrigin = universe_origin;
+    m_RuntimeState.TransformDeviceIndex    = vr::k_unTrackedDeviceIndexInvalid;
+    m_RuntimeState.Transform               = matrix;
+}
+
+void Overlay::SetTransformTrackedDeviceRelative(vr::TrackedDeviceIndex_t device_index, const vr::HmdMatrix34_t& matrix)
+{
+    if ( (m_RuntimeState.IsTransformValid) && (m_RuntimeState.TransformDeviceIndex == device_index) && (memcmp(&m_RuntimeState.Transform, &matrix, sizeof(vr::HmdMatrix34_t)) == 0) )
+        return;
+
+    vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(m_OvrlHandle, device_index, &matrix);
+
+    m_RuntimeState.IsTransformValid     = true;
+    m_RuntimeState.TransformDeviceIndex = device_index;
+    m_RuntimeState.Transform            = matrix;
+}
+
+void Overlay::SetWidth(float width)
+{
+    if (m_RuntimeState.Width == width)
+        return;
+
+    vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandle, width);
+    m_RuntimeState.Width = width;
+}
+
+void Overlay::SetCurvature(float curvature)
+{
+    if (m_RuntimeState.Curvature == curvature)
+        return;
+
+    vr::VROverlay()->SetOverlayCurvature(m_OvrlHandle, curvature);
+    m_RuntimeState.Curvature = curvature;
+}
+
+void Overlay::SetBrightness(float brightness)
+{
+    if (m_RuntimeState.Brightness == brightness)
+        return;
+
+    vr::VROverlay()->SetOverlayColor(m_OvrlHandle, brightness, brightness, brightness);
+    m_RuntimeState.Brightness = brightness;
+}
+
+void Overlay::SetTextureBounds(const vr::VRTextureBounds_t& bounds)
+{
+    if ( (m_RuntimeState.IsTextureBoundsValid) && (memcmp(&m_RuntimeState.TextureBounds, &bounds, sizeof(vr::VRTextureBounds_t)) == 0) )
+        return;
+
+    vr::VROverlay()->SetOverlayTextureBounds(m_OvrlHandle, &bounds);
+
+    m_RuntimeState.IsTextureBoundsValid = true;
+    m_RuntimeState.TextureBounds        = bounds;
+}
+
+void Overlay::SetMouseScale(const vr::HmdVector2_t& mouse_scale)
+{
+    if ( (m_RuntimeState.IsMouseScaleValid) && (m_RuntimeState.MouseScale.v[0] == mouse_scale.v[0]) && (m_RuntimeState.MouseScale.v[1] == mouse_scale.v[1]) )
+        return;
+
+    vr::VROverlay()->SetOverlayMouseScale(m_OvrlHandle, &mouse_scale);
+
+    m_RuntimeState.IsMouseScaleValid = true;
+    m_RuntimeState.MouseScale        = mouse_scale;
+}
+
+void Overlay::SetInputMethod(vr::VROverlayInputMethod input_method)
+{
+    if (m_RuntimeState.InputMethod == input_method)
+        return;
+
+    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandle, input_method);
+    m_RuntimeState.InputMethod = input_method;
+}
+
+vr::VROverlayInputMethod Overlay::GetInputMethod() const
+{
+    if (m_RuntimeState.InputMethod != -1)
+        return (vr::VROverlayInputMethod)m_RuntimeState.InputMethod;
+
+    vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
+    vr::VROverlay()->GetOverlayInputMethod(m_OvrlHandle, &input_method);
+
+    return input_method;
+}
+
+void Overlay::SetFlag(vr::VROverlayFlags flag, bool enabled)
+{
+    if ( (m_RuntimeState.FlagsKnown & flag) && ( ((m_RuntimeState.FlagsEnabled & flag) != 0) == enabled ) )
+        return;
+
+    vr::VROverlay()->SetOverlayFlag(m_OvrlHandle, flag, enabled);
+
+    m_RuntimeState.FlagsKnown |= flag;
+
+    if (enabled)
+        m_RuntimeState.FlagsEnabled |= flag;
+    else
+        m_RuntimeState.FlagsEnabled &= ~(uint32_t)flag;
+}
+
+bool Overlay::IsOutOfReach(const vr::HmdVector3_t& pos, float max_distance) const
+{
+    //Only absolute standing transforms with known size can be checked without asking the runtime
+    const OverlayRuntimeState& state = m_RuntimeState;
+
+    if ( (!state.IsTransformValid) || (state.TransformDeviceIndex != vr::k_unTrackedDeviceIndexInvalid) || (state.TransformUniverseOrigin != vr::TrackingUniverseStanding) || 
+         (state.Width <= 0.0f) || (!state.IsMouseScaleValid) || (!state.IsTextureBoundsValid) )
+    {
+        return false;
+    }
+
+    const float bounds_width  = (state.TextureBounds.uMax - state.TextureBounds.uMin) * state.MouseScale.v[0];
+    const float bounds_height = (state.TextureBounds.vMax - state.TextureBounds.vMin) * state.MouseScale.v[1];
+
+    if ( (bounds_width <= 0.0f) || (bounds_height <= 0.0f) )
+        return false;
+
+    //Overlay height derived from the visible texture area, doubled to stay on the safe side with texel aspect and 3D modes
+    //Curvature only ever moves the overlay closer to its center, so the sphere doesn't need to account for it
+    const float height = state.Width * (bounds_height / bounds_width) * 2.0f;
+
+    //Transforms can carry scale as well (dashboard and GamepadUI origins do), so use the largest axis scale on top
+    float scale_sq = 0.0f;
+    for (int i = 0; i < 3; ++i)
+    {
+        scale_sq = std::max(scale_sq, (state.Transform.m[0][i] * state.Transform.m[0][i]) + (state.Transform.m[1][i] * state.Transform.m[1][i]) + 
+                                      (state.Transform.m[2][i] * state.Transform.m[2][i]));
+    }
+
+    const float radius = std::max(state.Width, height) * sqrtf(scale_sq);
+
+    const float dx = state.Transform.m[0][3] - pos.v[0];
+    const float dy = state.Transform.m[1][3] - pos.v[1];
+    const float dz = state.Transform.m[2][3] - pos.v[2];
+    const float dist_max = max_distance + radius;
+
+    return (dx * dx + dy * dy + dz * dz > dist_max * dist_max);
+}
+
+void Overlay::InvalidateRuntimeState()
+{
+    m_RuntimeState = OverlayRuntimeState();
+}
+
+void Overlay::InvalidateRuntimeTransformState()
+{
+    m_RuntimeState.IsTransformValid = false;
+    m_RuntimeState.Width            = -1.0f;
+    m_RuntimeState.Curvature        = -1.0f;
+}
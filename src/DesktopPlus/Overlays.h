@@ -24,16 +24,39 @@ enum OverlayTextureSource
     ovrl_texsource_browser
 };
 
+//Shadow copy of the overlay properties last applied to the VR runtime through the Overlay class
+//The same values tend to be applied over and over on config changes and profile loads, this allows skipping the calls that wouldn't change anything
+//Values are never read back from the runtime, so anything setting these properties without going through the Overlay functions has to invalidate the state
+struct OverlayRuntimeState
+{
+    bool IsTransformValid = false;
+    vr::ETrackingUniverseOrigin TransformUniverseOrigin = vr::TrackingUniverseStanding;
+    vr::TrackedDeviceIndex_t TransformDeviceIndex = vr::k_unTrackedDeviceIndexInvalid;    //k_unTrackedDeviceIndexInvalid for absolute transforms
+    vr::HmdMatrix34_t Transform = {0};
+    float Width      = -1.0f;
+    float Curvature  = -1.0f;
+    float Brightness = -1.0f;
+    bool IsTextureBoundsValid = false;
+    vr::VRTextureBounds_t TextureBounds = {0};
+    bool IsMouseScaleValid = false;
+    vr::HmdVector2_t MouseScale = {0};
+    int InputMethod = -1;
+    uint32_t FlagsKnown   = 0;                                                            //Flags which state is known, as we don't touch most of them
+    uint32_t FlagsEnabled = 0;
+};
+
 class Overlay
 {
     private:
         unsigned int m_ID;
         vr::VROverlayHandle_t m_OvrlHandle;
         bool m_Visible;                       //IVROverlay::IsOverlayVisible() is unreliable if the state changed during the same frame so we keep track ourselves
+        ULONGLONG m_HideTick;                 //Tick of the last time the overlay was hidden or had its handle changed, events are still polled for a bit after that
         float m_Opacity;                      //This is the opacity the overlay is currently set at, which may differ from what the config value is
         DPRect m_ValidatedCropRect;           //Validated cropping rectangle used in OutputManager::Update() to check against dirty update regions
         OverlayTextureSource m_TextureSource;
         OUtoSBSConverter m_OUtoSBSConverter;
+        OverlayRuntimeState m_RuntimeState;
 
     public:
         Overlay(unsigned int id);
@@ -54,6 +77,7 @@ class Overlay
         void SetVisible(bool visible);      //Call OutputManager::Show/HideOverlay() instead of this to properly manage duplication state based on active overlays
         bool IsVisible() const;
         bool ShouldBeVisible() const;
+        bool IsEventPollNeeded() const;     //False if the overlay has been hidden long enough to not receive any events anymore
 
         void UpdateValidatedCropRect();
         const DPRect& GetValidatedCropRect() const;
@@ -61,4 +85,20 @@ class Overlay
         void SetTextureSource(OverlayTextureSource tex_source);
         OverlayTextureSource GetTextureSource() const;
         void OnDesktopDuplicationUpdate();  //Called by OutputManager::RefreshOpenVROverlayTexture() for every overlay, but only if the texture has actually changed
+
+        //-Runtime state functions
+        //These call the matching IVROverlay functions, but only if the value differs from what was last set through them
+        void SetTransformAbsolute(vr::ETrackingUniverseOrigin universe_origin, const vr::HmdMatrix34_t& matrix);
+        void SetTransformTrackedDeviceRelative(vr::TrackedDeviceIndex_t device_index, const vr::HmdMatrix34_t& matrix);
+        void SetWidth(float width);
+        void SetCurvature(float curvature);
+        void SetBrightness(float brightness);
+        void SetTextureBounds(const vr::VRTextureBounds_t& bounds);
+        void SetMouseScale(const vr::HmdVector2_t& mouse_scale);
+        void SetInputMethod(vr::VROverlayInputMethod input_method);
+        vr::VROverlayInputMethod GetInputMethod() const;    //Only calls into the runtime if the input method wasn't set through SetInputMethod()
+        void SetFlag(vr::VROverlayFlags flag, bool enabled);
+        bool IsOutOfReach(const vr::HmdVector3_t& pos, float max_distance) const; //Conservative check against the bounding sphere of the last absolute transform, false if unknown
+        void InvalidateRuntimeState();      //Call after the overlay's properties were changed outside of the functions above (e.g. by another process)
+        void InvalidateRuntimeTransformState(); //Same, but only for transform, width and curvature (e.g. changed by OverlayDragger)
 };
\ No newline at end of file
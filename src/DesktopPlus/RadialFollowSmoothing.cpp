@@ -17,6 +17,7 @@ double RadialFollowCore::GetOuterRadius()
 void RadialFollowCore::SetOuterRadius(double value)
 {
     m_RadiusOuter = clamp(m_RadiusOuter, 0.0, 1000000.0);
+    UpdateDerivedParams();
 }
 
 double RadialFollowCore::GetInnerRadius()
@@ -27,6 +28,7 @@ double RadialFollowCore::GetInnerRadius()
 void RadialFollowCore::SetInnerRadius(double value)
 {
     m_RadiusInner = clamp(value, 0.0, 1000000.0);
+    UpdateDerivedParams();
 }
 
 double RadialFollowCore::GetSmoothingCoefficient()
@@ -137,10 +139,11 @@ Vector2 RadialFollowCore::Filter(Vector2 target)
     m_LastPos = m_LastPos + (direction * distToMove);
 
     //Catch NaNs and interrupted input
-    if ( !((std::isfinite(m_LastPos.x)) && (std::isfinite(m_LastPos.y)) && (::GetTickCount64() <= m_LastTick + 50)) )
+    const ULONGLONG tick = ::GetTickCount64();
+    if ( !((std::isfinite(m_LastPos.x)) && (std::isfinite(m_LastPos.y)) && (tick <= m_LastTick + 50)) )
 	    m_LastPos = target;
 
-    m_LastTick = ::GetTickCount64();
+    m_LastTick = tick;
 
     return m_LastPos;
 }
@@ -157,6 +160,9 @@ void RadialFollowCore::UpdateDerivedParams()
 		m_XOffset   = -1.0;
 		m_ScaleComp =  1.0;
 	}
+
+	m_RadiusInnerAdjusted = GetRadiusInnerAdjusted();
+	m_RadiusRangeAdjusted = GetRadiusOuterAdjusted() - m_RadiusInnerAdjusted;
 }
 
 double RadialFollowCore::KneeFunc(double x)
@@ -226,10 +232,10 @@ double RadialFollowCore::SmoothedFn(double x, double offset, double scaleComp)
 
 double RadialFollowCore::ScaleToOuter(double x, double offset, double scaleComp)
 {
-    return (GetRadiusOuterAdjusted() - GetRadiusInnerAdjusted()) * SmoothedFn(x / (GetRadiusOuterAdjusted() - GetRadiusInnerAdjusted()), offset, scaleComp);
+    return m_RadiusRangeAdjusted * SmoothedFn(x / m_RadiusRangeAdjusted, offset, scaleComp);
 }
 
 double RadialFollowCore::DeltaFn(double x, double offset, double scaleComp)
 {
-    return (x > GetRadiusInnerAdjusted()) ? x - ScaleToOuter(x - GetRadiusInnerAdjusted(), offset, scaleComp) - GetRadiusInnerAdjusted() : 0.0;
+    return (x > m_RadiusInnerAdjusted) ? x - ScaleToOuter(x - m_RadiusInnerAdjusted, offset, scaleComp) - m_RadiusInnerAdjusted : 0.0;
 }
@@ -46,6 +46,8 @@ class RadialFollowCore
 
 		double m_XOffset   = -1.0;
 		double m_ScaleComp =  1.0;
+		double m_RadiusInnerAdjusted = 0.0;     //Cached results of GetRadius*Adjusted(), as Filter() is called for every pointer movement
+		double m_RadiusRangeAdjusted = 5.0;
 
 		void UpdateDerivedParams();
 
@@ -17,6 +17,8 @@
 #include "DesktopPlusWinRT.h"
 #include "DPBrowserAPIClient.h"
 
+#define UI_INTERSECTION_MASK_SEND_DELAY_MS 100
+
 //This one holds mostly constant data, but depends on how the application was launched
 static UITextureSpaces g_UITextureSpaces;
 
@@ -271,7 +273,9 @@ UIManager::UIManager(bool desktop_mode, bool keyboard_editor_mode) :
     m_OvrlPixelWidth(1),
     m_OvrlPixelHeight(1),
     m_TransformSyncValueCount(0),
-    m_TransformSyncValues{0}
+    m_TransformSyncValues{0},
+    m_UIIntersectionMaskResend(false),
+    m_UIIntersectionMaskSendTick(0)
 {
     g_UIManagerPtr = this;
 
@@ -612,6 +616,9 @@ vr::EVRInitError UIManager::InitOverlay()
 
 void UIManager::HandleIPCMessage(const MSG& msg, bool handle_delayed)
 {
+    //Opt-in trace of all received messages with handler duration, enabled by launching with verbosity 2 or higher (-v 2)
+    DPLog_IPCMessageTrace ipc_trace(IPCManager::Get().GetIPCMessageID(msg.message), msg.message, msg.wParam, msg.lParam);
+
     //Handle messages sent by browser process in the APIClient
     if (msg.message == DPBrowserAPIClient::Get().GetRegisteredMessageID())
     {
@@ -679,6 +686,9 @@ void UIManager::HandleIPCMessage(const MSG& msg, bool handle_delayed)
             {
                 case ipcact_overlays_reset:
                 {
+                    //Also sent by a (re)started dashboard app, which doesn't have our intersection mask yet
+                    m_UIIntersectionMaskResend = true;
+
                     UpdateDesktopOverlayPixelSize();
                     m_WindowPerformance.ScheduleOverlaySharedTextureUpdate();
                     break;
@@ -1270,25 +1280,44 @@ bool UIManager::IsDummyOverlayTransformUnstable() const
     return m_IsDummyOverlayTransformUnstable;
 }
 
-void UIManager::SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives) const
+void UIManager::SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives)
 {
-    static ULONGLONG last_tick = 0;
-
-    //Mask can change at any time, any frame. We don't really want to send too many messages either though, so we limit the rate and don't update at all if the pointer isn't active
-    if ( (ConfigManager::GetValue(configid_int_state_dplus_laser_pointer_device) != vr::k_unTrackedDeviceIndexInvalid) && (last_tick + 100 > ::GetTickCount64()) )
-        return;
+    //Mask is packed into the form it's sent in and compared against what was last sent, since it's only changing sometimes
+    m_UIIntersectionMaskPacked.clear();
 
     for (const auto& rect : primitives)
     {
         DPRect dp_rect((int)rect.m_Primitive.m_Rectangle.m_flTopLeftX,  (int)rect.m_Primitive.m_Rectangle.m_flTopLeftY, 
                        (int)rect.m_Primitive.m_Rectangle.m_flTopLeftX + (int)rect.m_Primitive.m_Rectangle.m_flWidth, (int)rect.m_Primitive.m_Rectangle.m_flTopLeftY + (int)rect.m_Primitive.m_Rectangle.m_flHeight);
 
-        IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_lpointer_ui_mask_rect, (LPARAM)dp_rect.Pack16());
+        m_UIIntersectionMaskPacked.push_back((LPARAM)dp_rect.Pack16());
+    }
+
+    if ( (m_UIIntersectionMaskPacked == m_UIIntersectionMaskPackedLast) && (!m_UIIntersectionMaskResend) )
+        return;
+
+    //It changes every frame while windows are moved or resized though, and each rect is a message, so limit the rate while the pointer is active.
+    //The latest mask still goes out once the delay has passed since it stays different from the last sent one
+    if ( (ConfigManager::GetValue(configid_int_state_dplus_laser_pointer_device) != vr::k_unTrackedDeviceIndexInvalid) && 
+         (m_UIIntersectionMaskSendTick + UI_INTERSECTION_MASK_SEND_DELAY_MS > ::GetTickCount64()) )
+    {
+        return;
+    }
+
+    bool post_ok = true;
+
+    for (LPARAM rect_packed : m_UIIntersectionMaskPacked)
+    {
+        post_ok &= IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_lpointer_ui_mask_rect, rect_packed);
     }
 
-    IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_lpointer_ui_mask_rect, -1); //Mark end of mask
+    post_ok &= IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_lpointer_ui_mask_rect, -1); //Mark end of mask
+
+    //Try again next time if the dashboard app didn't get it (not running or restarting)
+    m_UIIntersectionMaskResend   = !post_ok;
+    m_UIIntersectionMaskSendTick = ::GetTickCount64();
 
-    last_tick = ::GetTickCount64();
+    m_UIIntersectionMaskPacked.swap(m_UIIntersectionMaskPackedLast);
 }
 
 UIManager::IdleState& UIManager::GetIdleState()
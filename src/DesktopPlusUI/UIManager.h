@@ -157,6 +157,11 @@ class UIManager
 
         std::vector<MSG> m_DelayedICPMessages;  //Stores ICP messages that need to be delayed for processing within an ImGui frame
 
+        std::vector<LPARAM> m_UIIntersectionMaskPacked;
+        std::vector<LPARAM> m_UIIntersectionMaskPackedLast;     //Last mask sent to the dashboard app
+        bool m_UIIntersectionMaskResend;                        //Set when the dashboard app may not have the last mask (failed send or dashboard app restart)
+        ULONGLONG m_UIIntersectionMaskSendTick;
+
         void DisplayDashboardAppError(const std::string& str);
         void DisplayInitialSetupNotification();
         void SetOverlayInputEnabled(bool is_enabled);
@@ -206,7 +211,7 @@ class UIManager
         vr::VROverlayHandle_t GetOverlayHandleSystemUI()           const;
         std::array<vr::VROverlayHandle_t, 6> GetUIOverlayHandles() const;
         bool IsDummyOverlayTransformUnstable() const;
-        void SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives) const;
+        void SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives);
 
         IdleState& GetIdleState();
         DPRect CalcRectForActiveTexspace();
@@ -1,3 +1,6 @@
+//codecvt_utf16 is deprecated starting C++17, but still the most straight forward way to read the Vive Wireless logs (see UpdateStatValuesViveWireless())
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+
 #include "WindowPerformance.h"
 
 #include <fstream>
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <random>
 #include <ctime>
+#include <mutex>
 
 #ifndef NOMINMAX
     #define NOMINMAX
@@ -28,6 +29,8 @@
     #include "ImGuiExt.h"
 #endif
 
+#define SHELLEXECUTE_ASYNC_MAX_PENDING 8
+
 /*
 Command type data
 -
@@ -59,120 +62,76 @@ const char* ActionCommand::s_CommandTypeNames[ActionCommand::command_MAX] =
 
 std::string ActionCommand::Serialize() const
 {
-    std::stringstream ss(std::ios::out | std::ios::binary);
-    size_t str_size = 0;
-
-    ss.write((const char*)&Type,     sizeof(Type));
-    ss.write((const char*)&UIntID,   sizeof(UIntID));
-    ss.write((const char*)&UIntArg,  sizeof(UIntArg));
-
-    str_size = StrMain.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(StrMain.data(),         str_size);
+    std::string str;
 
-    str_size = StrArg.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(StrArg.data(),          str_size);
+    SerializeWrite(str, Type);
+    SerializeWrite(str, UIntID);
+    SerializeWrite(str, UIntArg);
+    SerializeWriteString(str, StrMain);
+    SerializeWriteString(str, StrArg);
 
-    return ss.str();
+    return str;
 }
 
 void ActionCommand::Deserialize(const std::string& str)
 {
-    std::stringstream ss(str, std::ios::in | std::ios::binary);
+    SerializeReader reader(str);
 
     ActionCommand new_command;
-    size_t str_length = 0;
-
-    ss.read((char*)&new_command.Type,    sizeof(Type));
-    ss.read((char*)&new_command.UIntID,  sizeof(UIntID));
-    ss.read((char*)&new_command.UIntArg, sizeof(UIntArg));
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, (size_t)4096);    //Arbitrary size limit to avoid large allocations on garbage data
-    new_command.StrMain.resize(str_length);
-    ss.read(&new_command.StrMain[0], str_length);
+    reader.Read(new_command.Type);
+    reader.Read(new_command.UIntID);
+    reader.Read(new_command.UIntArg);
+    reader.ReadString(new_command.StrMain, 4096);   //Arbitrary size limit to avoid large allocations on garbage data
+    reader.ReadString(new_command.StrArg,  4096);
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, (size_t)4096);
-    new_command.StrArg.resize(str_length);
-    ss.read(&new_command.StrArg[0], str_length);
-
-    //Replace all data with the read command if there were no stream errors
-    if (ss.good())
+    //Replace all data with the read command if there were no read errors
+    if (reader.IsGood())
         *this = new_command;
 }
 
 
 std::string Action::Serialize() const
 {
-    std::stringstream ss(std::ios::out | std::ios::binary);
-    size_t str_size = 0;
-
-    ss.write((const char*)&UID, sizeof(UID));
-
-    str_size = Name.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(Name.data(),            str_size);
+    std::string str;
 
-    str_size = Label.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(Label.data(),           str_size);
+    SerializeWrite(str, UID);
+    SerializeWriteString(str, Name);
+    SerializeWriteString(str, Label);
 
-    size_t command_count = Commands.size();
-    ss.write((const char*)&command_count, sizeof(command_count));
+    SerializeWrite(str, Commands.size());
 
     for (const auto& command : Commands)
     {
-        std::string command_serialized = command.Serialize();
-
-        str_size = command_serialized.size();
-        ss.write((const char*)&str_size,    sizeof(str_size));
-        ss.write(command_serialized.data(), str_size);
+        SerializeWriteString(str, command.Serialize());
     }
 
-    ss.write((const char*)&TargetUseTags, sizeof(TargetUseTags));
+    SerializeWrite(str, TargetUseTags);
 
     //Tags are still preserved even when not used
-    str_size = TargetTags.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(TargetTags.data(),      str_size);
-
-    str_size = IconFilename.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(IconFilename.data(),    str_size);
+    SerializeWriteString(str, TargetTags);
+    SerializeWriteString(str, IconFilename);
 
-    return ss.str();
+    return str;
 }
 
 void Action::Deserialize(const std::string& str)
 {
-    std::stringstream ss(str, std::ios::in | std::ios::binary);
+    SerializeReader reader(str);
 
     Action new_action;
-    size_t str_length = 0;
-
-    ss.read((char*)&new_action.UID,    sizeof(UID));
-
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.Name.resize(str_length);
-    ss.read(&new_action.Name[0], str_length);
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.Label.resize(str_length);
-    ss.read(&new_action.Label[0], str_length);
+    reader.Read(new_action.UID);
+    reader.ReadString(new_action.Name,  str.length());
+    reader.ReadString(new_action.Label, str.length());
 
     size_t command_count = 0;
-    ss.read((char*)&command_count,     sizeof(command_count));
+    reader.Read(command_count);
 
-    for (size_t i = 0; i < command_count; ++i)
+    std::string command_serialized;
+    for (size_t i = 0; (i < command_count) && (reader.IsGood()); ++i)
     {
-        ss.read((char*)&str_length, sizeof(str_length));
-        str_length = std::min(str_length, str.length());
-        std::string command_serialized(str_length, '\0');
-        ss.read(&command_serialized[0], str_length);
+        reader.ReadString(command_serialized, str.length());
 
         ActionCommand new_command;
         new_command.Deserialize(command_serialized);
@@ -180,20 +139,12 @@ void Action::Deserialize(const std::string& str)
         new_action.Commands.push_back(new_command);
     }
 
-    ss.read((char*)&new_action.TargetUseTags, sizeof(TargetUseTags));
+    reader.Read(new_action.TargetUseTags);
+    reader.ReadString(new_action.TargetTags,   str.length());
+    reader.ReadString(new_action.IconFilename, str.length());
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.TargetTags.resize(str_length);
-    ss.read(&new_action.TargetTags[0], str_length);
-
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.IconFilename.resize(str_length);
-    ss.read(&new_action.IconFilename[0], str_length);
-
-    //Replace all data with the read action if there were no stream errors
-    if (ss.good())
+    //Replace all data with the read action if there were no read errors
+    if (reader.IsGood())
     {
         *this = new_action;
 
@@ -217,6 +168,74 @@ ActionManager::ActionManager()
 
 #ifndef DPLUS_UI
 
+struct ShellExecuteAsyncData
+{
+    std::wstring File;
+    std::wstring Parameters;
+};
+
+static std::mutex g_ShellExecuteAsyncMutex;
+static std::vector<ShellExecuteAsyncData*> g_ShellExecuteAsyncPending;
+
+static DWORD WINAPI ShellExecuteAsyncThreadEntry(void* param)
+{
+    ShellExecuteAsyncData* data = (ShellExecuteAsyncData*)param;
+
+    //Some file associations and URL handlers need COM
+    HRESULT hr_com = ::CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED | COINIT_DISABLE_OLE1DDE);
+
+    INT_PTR result = (INT_PTR)::ShellExecute(nullptr, nullptr, data->File.c_str(), data->Parameters.c_str(), nullptr, SW_SHOWNORMAL);
+
+    LOG_IF_F(WARNING, result <= 32, "ShellExecute() failed for \"%s\" with error %lld", StringConvertFromUTF16(data->File.c_str()).c_str(), (long long)result);
+
+    if (SUCCEEDED(hr_com))
+    {
+        ::CoUninitialize();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_ShellExecuteAsyncMutex);
+        g_ShellExecuteAsyncPending.erase(std::find(g_ShellExecuteAsyncPending.begin(), g_ShellExecuteAsyncPending.end(), data));
+    }
+
+    delete data;
+    return 0;
+}
+
+bool ActionManager::LaunchApplicationAsync(const std::wstring& file, const std::wstring& parameters)
+{
+    std::lock_guard<std::mutex> lock(g_ShellExecuteAsyncMutex);
+
+    //Skip launches identical to one still in progress (e.g. from repeated button presses) and don't pile up threads stuck on unresponsive handlers
+    auto it = std::find_if(g_ShellExecuteAsyncPending.begin(), g_ShellExecuteAsyncPending.end(), 
+                           [&](const auto* data){ return ((data->File == file) && (data->Parameters == parameters)); });
+
+    if (it != g_ShellExecuteAsyncPending.end())
+        return false;
+
+    if (g_ShellExecuteAsyncPending.size() >= SHELLEXECUTE_ASYNC_MAX_PENDING)
+    {
+        LOG_F(WARNING, "Too many pending ShellExecute() calls, skipping launch of \"%s\"", StringConvertFromUTF16(file.c_str()).c_str());
+        return false;
+    }
+
+    ShellExecuteAsyncData* data = new ShellExecuteAsyncData{file, parameters};
+
+    //Thread can't remove itself from the pending list before it's added to it, as the mutex is held until this function returns
+    HANDLE thread_handle = ::CreateThread(nullptr, 0, ShellExecuteAsyncThreadEntry, data, 0, nullptr);
+
+    if (thread_handle == nullptr)
+    {
+        delete data;
+        return false;
+    }
+
+    ::CloseHandle(thread_handle);
+    g_ShellExecuteAsyncPending.push_back(data);
+
+    return true;
+}
+
 void ActionManager::DoKeyCommand(const ActionCommand& command, OverlayIDList& overlay_targets, bool down) const
 {
     bool has_pressed_for_desktop = false;   //Only do command once for inputs that end up on the desktop
@@ -343,18 +362,11 @@ void ActionManager::DoLaunchAppCommand(const ActionCommand& command, OverlayIDLi
         return;
     }
 
-    //Convert path and arg to utf16
-    std::wstring path_wstr = WStringConvertFromUTF8(path_utf8.c_str());
-    std::wstring arg_wstr  = WStringConvertFromUTF8(arg_utf8.c_str());
-
-    if (!path_wstr.empty())
+    //Path and arg were already converted to utf16 when the action was stored
+    if (!command.StrMainW.empty())
     {
-        if (OutputManager* outmgr = OutputManager::Get())
-        {
-            outmgr->InitComIfNeeded();
-
-            ::ShellExecute(nullptr, nullptr, path_wstr.c_str(), arg_wstr.c_str(), nullptr, SW_SHOWNORMAL);
-        }
+        //Launching can block for quite a while (elevation prompts, URL handlers, network paths), so don't do it on this thread
+        LaunchApplicationAsync(command.StrMainW, command.StrArgW);
     }
 }
 
@@ -511,6 +523,18 @@ void ActionManager::DoLoadOverlayProfileCommand(const ActionCommand& command, Ov
     }
 }
 
+void ActionManager::PrepareActionCommands(Action& action)
+{
+    for (ActionCommand& command : action.Commands)
+    {
+        if (command.Type == ActionCommand::command_launch_app)
+        {
+            command.StrMainW = WStringConvertFromUTF8(command.StrMain.c_str());
+            command.StrArgW  = WStringConvertFromUTF8(command.StrArg.c_str());
+        }
+    }
+}
+
 #endif //ifdef DPLUS_UI
 
 #ifdef DPLUS_UI
@@ -723,7 +747,12 @@ void ActionManager::StoreAction(const Action& action)
 {
     size_t action_count_prev = m_Actions.size();
 
-    m_Actions[action.UID] = action;
+    Action& action_stored = m_Actions[action.UID];
+    action_stored = action;
+
+    #ifndef DPLUS_UI
+        PrepareActionCommands(action_stored);
+    #endif
 
     #ifdef DPLUS_UI
         //Add to UI order if this added a new action
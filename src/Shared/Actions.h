@@ -43,6 +43,11 @@ struct ActionCommand
     std::string StrMain;
     std::string StrArg;
 
+    #ifndef DPLUS_UI
+        std::wstring StrMainW;                  //UTF-16 copies of the strings for commands passing them to Win32 functions, set by ActionManager::StoreAction()
+        std::wstring StrArgW;
+    #endif
+
     std::string Serialize() const;              //Serializes into binary data stored as string (contains NUL bytes), not suitable for storage
     void Deserialize(const std::string& str);   //Deserializes from strings created by above function
 };
@@ -104,6 +109,8 @@ class ActionManager
             void DoShowOverlayCommand(       const ActionCommand& command, OverlayIDList& overlay_targets, bool undo) const;
             void DoSwitchTaskCommand(        const ActionCommand& command, OverlayIDList& overlay_targets)            const;
             void DoLoadOverlayProfileCommand(const ActionCommand& command, OverlayIDList& overlay_targets)            const;
+
+            static void PrepareActionCommands(Action& action);   //Pre-computes data of stored actions so it isn't done on every invocation
         #endif
 
         #ifdef DPLUS_UI
@@ -133,6 +140,11 @@ class ActionManager
         static std::string ActionOrderListToString(const ActionList& action_order);
         static ActionList ActionOrderListFromString(const std::string& str);
 
+        #ifndef DPLUS_UI
+            //ShellExecute() on a separate thread. Returns false if skipped because the same launch is still pending or too many are
+            static bool LaunchApplicationAsync(const std::wstring& file, const std::wstring& parameters);
+        #endif
+
         #ifdef DPLUS_UI
             ActionUID DuplicateAction(const Action& action);        //Returns UID of new action
             void ClearIconData();                                   //Resets icon-related values of all actions, used when reloading textures
@@ -1,7 +1,5 @@
 #include "AppProfiles.h"
 
-#include <sstream>
-
 #ifndef DPLUS_UI
     #include "OutputManager.h"
 #endif
@@ -327,49 +325,31 @@ std::vector<std::string> AppProfileManager::GetProfileAppKeyList() const
 
 std::string AppProfile::Serialize() const
 {
-    std::stringstream ss(std::ios::out | std::ios::binary);
-    size_t str_size = 0;
-
-    ss.write((const char*)&IsEnabled, sizeof(IsEnabled));
-
-    str_size = LastApplicationName.size();
-    ss.write((const char*)&str_size,        sizeof(str_size));
-    ss.write(LastApplicationName.data(),    str_size);
-
-    str_size = OverlayProfileFileName.size();
-    ss.write((const char*)&str_size,        sizeof(str_size));
-    ss.write(OverlayProfileFileName.data(), str_size);
+    std::string str;
 
-    ss.write((const char*)&ActionUIDEnter, sizeof(ActionUIDEnter));
-    ss.write((const char*)&ActionUIDLeave, sizeof(ActionUIDLeave));
+    SerializeWrite(str, IsEnabled);
+    SerializeWriteString(str, LastApplicationName);
+    SerializeWriteString(str, OverlayProfileFileName);
+    SerializeWrite(str, ActionUIDEnter);
+    SerializeWrite(str, ActionUIDLeave);
 
-    return ss.str();
+    return str;
 }
 
 void AppProfile::Deserialize(const std::string& str)
 {
-    std::stringstream ss(str, std::ios::in | std::ios::binary);
+    SerializeReader reader(str);
 
     AppProfile new_profile;
-    size_t str_length = 0;
-
-    ss.read((char*)&new_profile.IsEnabled, sizeof(IsEnabled));
-
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, (size_t)4096);    //Arbitrary size limit to avoid large allocations on garbage data
-    new_profile.LastApplicationName.resize(str_length);
-    ss.read(&new_profile.LastApplicationName[0], str_length);
-
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, (size_t)4096);
-    new_profile.OverlayProfileFileName.resize(str_length);
-    ss.read(&new_profile.OverlayProfileFileName[0], str_length);
 
-    ss.read((char*)&new_profile.ActionUIDEnter, sizeof(ActionUIDEnter));
-    ss.read((char*)&new_profile.ActionUIDLeave, sizeof(ActionUIDLeave));
+    reader.Read(new_profile.IsEnabled);
+    reader.ReadString(new_profile.LastApplicationName,    4096);    //Arbitrary size limit to avoid large allocations on garbage data
+    reader.ReadString(new_profile.OverlayProfileFileName, 4096);
+    reader.Read(new_profile.ActionUIDEnter);
+    reader.Read(new_profile.ActionUIDLeave);
 
-    //Replace all data with the read profile if there were no stream errors
-    if (ss.good())
+    //Replace all data with the read profile if there were no read errors
+    if (reader.IsGood())
         *this = new_profile;
 }
 
@@ -49,27 +49,27 @@ static const std::pair<OverlayOrigin, const char*> g_OvrlOriginConfigFileStrings
 
 std::string ConfigHotkey::Serialize() const
 {
-    std::stringstream ss(std::ios::out | std::ios::binary);
+    std::string str;
 
-    ss.write((const char*)&KeyCode,   sizeof(KeyCode));
-    ss.write((const char*)&Modifiers, sizeof(Modifiers));
-    ss.write((const char*)&ActionUID, sizeof(ActionUID));
+    SerializeWrite(str, KeyCode);
+    SerializeWrite(str, Modifiers);
+    SerializeWrite(str, ActionUID);
 
-    return ss.str();
+    return str;
 }
 
 void ConfigHotkey::Deserialize(const std::string& str)
 {
-    std::stringstream ss(str, std::ios::in | std::ios::binary);
+    SerializeReader reader(str);
 
     ConfigHotkey new_hotkey;
 
-    ss.read((char*)&new_hotkey.KeyCode,   sizeof(KeyCode));
-    ss.read((char*)&new_hotkey.Modifiers, sizeof(Modifiers));
-    ss.read((char*)&new_hotkey.ActionUID, sizeof(ActionUID));
+    reader.Read(new_hotkey.KeyCode);
+    reader.Read(new_hotkey.Modifiers);
+    reader.Read(new_hotkey.ActionUID);
 
-    //Replace all data with the read hotkey if there were no stream errors
-    if (ss.good())
+    //Replace all data with the read hotkey if there were no read errors
+    if (reader.IsGood())
     {
         *this = new_hotkey;
     }
@@ -172,8 +172,10 @@ void DPBrowserAPIClient::ApplyPendingSettings()
     #endif
 }
 
-void DPBrowserAPIClient::SendStringMessage(DPBrowserICPStringID str_id, const std::string& str) const
+void DPBrowserAPIClient::SendStringMessage(DPBrowserICPStringID str_id, const std::string& str)
 {
+    FlushPendingInput();
+
     HWND source_window = nullptr;
     #ifdef DPLUS_UI
         if (UIManager* uimgr = UIManager::Get())
@@ -198,6 +200,12 @@ void DPBrowserAPIClient::SendStringMessage(DPBrowserICPStringID str_id, const st
     }
 }
 
+void DPBrowserAPIClient::PostServerMessage(DPBrowserICPCommandID command_id, LPARAM lparam)
+{
+    FlushPendingInput();
+    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, command_id, lparam);
+}
+
 std::string& DPBrowserAPIClient::GetIPCString(DPBrowserICPStringID str_id)
 {
     return m_IPCStrings[str_id - dpbrowser_ipcstr_MIN];
@@ -257,6 +265,37 @@ UINT DPBrowserAPIClient::GetRegisteredMessageID() const
     return m_Win32MessageID;
 }
 
+void DPBrowserAPIClient::FlushPendingInput()
+{
+    if ( (m_PendingMouseMoveTarget == vr::k_ulOverlayHandleInvalid) && (m_PendingScrollTarget == vr::k_ulOverlayHandleInvalid) )
+        return;
+
+    if (m_ServerWindowHandle != nullptr)
+    {
+        //Moves are sent first since scrolls are never held back past a move
+        if (m_PendingMouseMoveTarget != vr::k_ulOverlayHandleInvalid)
+        {
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, m_PendingMouseMoveTarget);
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_move, MAKELPARAM(m_PendingMouseMoveX, m_PendingMouseMoveY));
+        }
+
+        if (m_PendingScrollTarget != vr::k_ulOverlayHandleInvalid)
+        {
+            //Squeeze the floats into DWORDs so they'll survive MAKEQWORD
+            DWORD x_delta_uint = pun_cast<DWORD, float>(m_PendingScrollX);
+            DWORD y_delta_uint = pun_cast<DWORD, float>(m_PendingScrollY);
+
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, m_PendingScrollTarget);
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_scroll, MAKEQWORD(x_delta_uint, y_delta_uint));
+        }
+    }
+
+    m_PendingMouseMoveTarget = vr::k_ulOverlayHandleInvalid;
+    m_PendingScrollTarget    = vr::k_ulOverlayHandleInvalid;
+    m_PendingScrollX         = 0.0f;
+    m_PendingScrollY         = 0.0f;
+}
+
 void DPBrowserAPIClient::HandleIPCMessage(const MSG& msg)
 {
     if (msg.message == WM_COPYDATA)
@@ -414,8 +453,8 @@ void DPBrowserAPIClient::DPBrowser_StartBrowser(vr::VROverlayHandle_t overlay_ha
         return;
 
     SendStringMessage(dpbrowser_ipcstr_url, url);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_start_browser, use_transparent_background);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_start_browser, use_transparent_background);
 }
 
 void DPBrowserAPIClient::DPBrowser_DuplicateBrowserOutput(vr::VROverlayHandle_t overlay_handle_src, vr::VROverlayHandle_t overlay_handle_dst)
@@ -423,8 +462,8 @@ void DPBrowserAPIClient::DPBrowser_DuplicateBrowserOutput(vr::VROverlayHandle_t
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle_src);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_duplicate_browser_output, overlay_handle_dst);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle_src);
+    PostServerMessage(dpbrowser_ipccmd_duplicate_browser_output, overlay_handle_dst);
 }
 
 void DPBrowserAPIClient::DPBrowser_PauseBrowser(vr::VROverlayHandle_t overlay_handle, bool pause)
@@ -432,8 +471,8 @@ void DPBrowserAPIClient::DPBrowser_PauseBrowser(vr::VROverlayHandle_t overlay_ha
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_pause_browser, pause);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_pause_browser, pause);
 }
 
 void DPBrowserAPIClient::DPBrowser_RecreateBrowser(vr::VROverlayHandle_t overlay_handle, bool use_transparent_background)
@@ -441,8 +480,8 @@ void DPBrowserAPIClient::DPBrowser_RecreateBrowser(vr::VROverlayHandle_t overlay
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_recreate_browser, use_transparent_background);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_recreate_browser, use_transparent_background);
 }
 
 void DPBrowserAPIClient::DPBrowser_StopBrowser(vr::VROverlayHandle_t overlay_handle)
@@ -450,7 +489,7 @@ void DPBrowserAPIClient::DPBrowser_StopBrowser(vr::VROverlayHandle_t overlay_han
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_stop_browser, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_stop_browser, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetURL(vr::VROverlayHandle_t overlay_handle, const std::string& url)
@@ -459,7 +498,7 @@ void DPBrowserAPIClient::DPBrowser_SetURL(vr::VROverlayHandle_t overlay_handle,
         return;
 
     SendStringMessage(dpbrowser_ipcstr_url, url);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_url, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_set_url, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetResolution(vr::VROverlayHandle_t overlay_handle, int width, int height)
@@ -467,8 +506,8 @@ void DPBrowserAPIClient::DPBrowser_SetResolution(vr::VROverlayHandle_t overlay_h
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_resoution, MAKELPARAM(width, height));
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_set_resoution, MAKELPARAM(width, height));
 }
 
 void DPBrowserAPIClient::DPBrowser_SetFPS(vr::VROverlayHandle_t overlay_handle, int fps)
@@ -476,8 +515,8 @@ void DPBrowserAPIClient::DPBrowser_SetFPS(vr::VROverlayHandle_t overlay_handle,
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_fps, fps);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_set_fps, fps);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetZoomLevel(vr::VROverlayHandle_t overlay_handle, float zoom_level)
@@ -485,8 +524,8 @@ void DPBrowserAPIClient::DPBrowser_SetZoomLevel(vr::VROverlayHandle_t overlay_ha
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_zoom, pun_cast<LPARAM, float>(zoom_level));
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_set_zoom, pun_cast<LPARAM, float>(zoom_level));
 }
 
 void DPBrowserAPIClient::DPBrowser_SetOverUnder3D(vr::VROverlayHandle_t overlay_handle, bool is_over_under_3D, int crop_x, int crop_y, int crop_width, int crop_height)
@@ -494,16 +533,16 @@ void DPBrowserAPIClient::DPBrowser_SetOverUnder3D(vr::VROverlayHandle_t overlay_
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
 
     if (is_over_under_3D)
     {
         DPRect dp_rect(crop_x, crop_y, crop_x + crop_width, crop_y + crop_height);
-        ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_ou3d_crop, (LPARAM)dp_rect.Pack16());
+        PostServerMessage(dpbrowser_ipccmd_set_ou3d_crop, (LPARAM)dp_rect.Pack16());
     }
     else
     {
-        ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_ou3d_crop, -1);
+        PostServerMessage(dpbrowser_ipccmd_set_ou3d_crop, -1);
     }
 }
 
@@ -512,8 +551,15 @@ void DPBrowserAPIClient::DPBrowser_MouseMove(vr::VROverlayHandle_t overlay_handl
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_move, MAKELPARAM(x, y));
+    //Pending scrolls happened before this move and need to go out first. Moves to other overlays can't be merged either
+    if ( (m_PendingScrollTarget != vr::k_ulOverlayHandleInvalid) || ((m_PendingMouseMoveTarget != vr::k_ulOverlayHandleInvalid) && (m_PendingMouseMoveTarget != overlay_handle)) )
+    {
+        FlushPendingInput();
+    }
+
+    m_PendingMouseMoveTarget = overlay_handle;
+    m_PendingMouseMoveX      = x;
+    m_PendingMouseMoveY      = y;
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseLeave(vr::VROverlayHandle_t overlay_handle)
@@ -521,7 +567,7 @@ void DPBrowserAPIClient::DPBrowser_MouseLeave(vr::VROverlayHandle_t overlay_hand
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_leave, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_mouse_leave, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseDown(vr::VROverlayHandle_t overlay_handle, vr::EVRMouseButton button)
@@ -529,8 +575,8 @@ void DPBrowserAPIClient::DPBrowser_MouseDown(vr::VROverlayHandle_t overlay_handl
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_down, button);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_mouse_down, button);
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseUp(vr::VROverlayHandle_t overlay_handle, vr::EVRMouseButton button)
@@ -538,8 +584,8 @@ void DPBrowserAPIClient::DPBrowser_MouseUp(vr::VROverlayHandle_t overlay_handle,
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_up, button);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_mouse_up, button);
 }
 
 void DPBrowserAPIClient::DPBrowser_Scroll(vr::VROverlayHandle_t overlay_handle, float x_delta, float y_delta)
@@ -547,12 +593,16 @@ void DPBrowserAPIClient::DPBrowser_Scroll(vr::VROverlayHandle_t overlay_handle,
     if (!IsServerRunning())
         return;
 
-    //Squeeze the floats into DWORDs so they'll survive MAKEQWORD
-    DWORD x_delta_uint = pun_cast<DWORD, float>(x_delta);
-    DWORD y_delta_uint = pun_cast<DWORD, float>(y_delta);
+    //A pending move to another overlay would end up after this scroll otherwise
+    if ( ((m_PendingScrollTarget != vr::k_ulOverlayHandleInvalid) && (m_PendingScrollTarget != overlay_handle)) || 
+         ((m_PendingMouseMoveTarget != vr::k_ulOverlayHandleInvalid) && (m_PendingMouseMoveTarget != overlay_handle)) )
+    {
+        FlushPendingInput();
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_scroll, MAKEQWORD(x_delta_uint, y_delta_uint));
+    m_PendingScrollTarget = overlay_handle;
+    m_PendingScrollX += x_delta;
+    m_PendingScrollY += y_delta;
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardSetKeyState(vr::VROverlayHandle_t overlay_handle, DPBrowserIPCKeyboardKeystateFlags flags, unsigned char keycode)
@@ -560,8 +610,8 @@ void DPBrowserAPIClient::DPBrowser_KeyboardSetKeyState(vr::VROverlayHandle_t ove
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_vkey, MAKELPARAM(flags, keycode));
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_keyboard_vkey, MAKELPARAM(flags, keycode));
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardToggleKey(vr::VROverlayHandle_t overlay_handle, unsigned char keycode)
@@ -569,8 +619,8 @@ void DPBrowserAPIClient::DPBrowser_KeyboardToggleKey(vr::VROverlayHandle_t overl
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_vkey_toggle, keycode);
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_keyboard_vkey_toggle, keycode);
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardTypeWChar(vr::VROverlayHandle_t overlay_handle, wchar_t wchar, bool down)
@@ -578,14 +628,14 @@ void DPBrowserAPIClient::DPBrowser_KeyboardTypeWChar(vr::VROverlayHandle_t overl
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_wchar, MAKELPARAM(wchar, down));
+    PostServerMessage(dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_keyboard_wchar, MAKELPARAM(wchar, down));
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardTypeString(vr::VROverlayHandle_t overlay_handle, const std::string& str)
 {
     SendStringMessage(dpbrowser_ipcstr_keyboard_string, str);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_string, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_keyboard_string, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_GoBack(vr::VROverlayHandle_t overlay_handle)
@@ -593,7 +643,7 @@ void DPBrowserAPIClient::DPBrowser_GoBack(vr::VROverlayHandle_t overlay_handle)
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_go_back, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_go_back, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_GoForward(vr::VROverlayHandle_t overlay_handle)
@@ -601,7 +651,7 @@ void DPBrowserAPIClient::DPBrowser_GoForward(vr::VROverlayHandle_t overlay_handl
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_go_forward, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_go_forward, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_Refresh(vr::VROverlayHandle_t overlay_handle)
@@ -609,7 +659,7 @@ void DPBrowserAPIClient::DPBrowser_Refresh(vr::VROverlayHandle_t overlay_handle)
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_refresh, overlay_handle);
+    PostServerMessage(dpbrowser_ipccmd_refresh, overlay_handle);
 }
 
 void DPBrowserAPIClient::DPBrowser_GlobalSetFPS(int fps)
@@ -620,7 +670,7 @@ void DPBrowserAPIClient::DPBrowser_GlobalSetFPS(int fps)
         return;
     }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_global_set_fps, fps);
+    PostServerMessage(dpbrowser_ipccmd_global_set_fps, fps);
 }
 
 void DPBrowserAPIClient::DPBrowser_ContentBlockSetEnabled(bool enable)
@@ -631,7 +681,7 @@ void DPBrowserAPIClient::DPBrowser_ContentBlockSetEnabled(bool enable)
         return;
     }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_cblock_set_enabled, enable);
+    PostServerMessage(dpbrowser_ipccmd_cblock_set_enabled, enable);
 }
 
 void DPBrowserAPIClient::DPBrowser_ErrorPageSetStrings(const std::string& title, const std::string& heading, const std::string& message)
@@ -646,5 +696,5 @@ void DPBrowserAPIClient::DPBrowser_ErrorPageSetStrings(const std::string& title,
     SendStringMessage(dpbrowser_ipcstr_tstr_error_heading, heading);
     SendStringMessage(dpbrowser_ipcstr_tstr_error_message, message);
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_error_set_strings, 0);
+    PostServerMessage(dpbrowser_ipccmd_error_set_strings, 0);
 }
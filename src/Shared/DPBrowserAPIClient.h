@@ -18,10 +18,19 @@ class DPBrowserAPIClient : public DPBrowserAPI
         int m_PendingSettingContentBlockEnabled = -1;
         bool m_PendingTranslationStrings = true;
 
+        //Mouse moves and scrolls are held back until FlushPendingInput() or the next other command, so high-rate pointer input only costs messages once per frame
+        vr::VROverlayHandle_t m_PendingMouseMoveTarget = vr::k_ulOverlayHandleInvalid;
+        int m_PendingMouseMoveX = 0;
+        int m_PendingMouseMoveY = 0;
+        vr::VROverlayHandle_t m_PendingScrollTarget = vr::k_ulOverlayHandleInvalid;
+        float m_PendingScrollX = 0.0f;
+        float m_PendingScrollY = 0.0f;
+
         bool LaunchServerIfNotRunning();                        //Should be called and checked for in most API implementations, also makes sure m_ServerWindowHandle is updated
         bool IsServerRunning();                                 //Also makes sure m_ServerWindowHandle is updated
         void ApplyPendingSettings();
-        void SendStringMessage(DPBrowserICPStringID str_id, const std::string& str) const;
+        void SendStringMessage(DPBrowserICPStringID str_id, const std::string& str);
+        void PostServerMessage(DPBrowserICPCommandID command_id, LPARAM lparam); //Flushes pending input first to keep everything in order
 
         std::string& GetIPCString(DPBrowserICPStringID str_id); //Abstracts the minimum string ID away when acccessing m_IPCStrings
 
@@ -35,6 +44,7 @@ class DPBrowserAPIClient : public DPBrowserAPI
         UINT GetRegisteredMessageID() const;
 
         void HandleIPCMessage(const MSG& msg);
+        void FlushPendingInput();                               //Sends out held back mouse moves and scrolls, call once per frame
 
         //DPBrowserAPI:
         virtual void DPBrowser_StartBrowser(vr::VROverlayHandle_t overlay_handle, const std::string& url, bool use_transparent_background) override;
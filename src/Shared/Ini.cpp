@@ -38,6 +38,7 @@ char const* ini_property_value( ini_t const* ini, int section, int property );
 
 int ini_find_section( ini_t const* ini, char const* name, int name_length );
 int ini_find_property( ini_t const* ini, int section, char const* name, int name_length );
+char const* ini_find_property_value( ini_t const* ini, int section, char const* name, int name_length );
 
 int ini_section_add( ini_t* ini, char const* name, int length );
 void ini_property_add( ini_t* ini, int section, char const* name, int name_length, char const* value, int value_length );
@@ -69,23 +70,31 @@ void ini_property_value_set( ini_t* ini, int section, int property, char const*
 #endif
 
 
+static bool ReadFileContents(const std::wstring& wfilename, std::string& contents)
+{
+    FILE* fp = _wfopen(wfilename.c_str(), L"rt");
+    if (fp == nullptr)
+        return false;
+
+    //Read entire file into string
+    fseek(fp, 0, SEEK_END);
+    contents.resize(ftell(fp));
+    rewind(fp);
+    size_t bytes_read = fread(&contents[0], 1, contents.size(), fp);
+    fclose(fp);
+
+    contents.resize(bytes_read);
+
+    return true;
+}
+
 Ini::Ini(const std::wstring& wfilename, bool replace_contents) : m_WFileName(wfilename), m_IniPtr(nullptr)
 {
     if (!replace_contents)
     {
-        FILE* fp = _wfopen(m_WFileName.c_str(), L"rt");
-        if (fp != nullptr)
+        std::string contents;
+        if (ReadFileContents(m_WFileName, contents))
         {
-            //Read entire file into string
-            std::string contents;
-            fseek(fp, 0, SEEK_END);
-            contents.resize(ftell(fp));
-            rewind(fp);
-            size_t bytes_read = fread(&contents[0], 1, contents.size(), fp);
-            fclose(fp);
-
-            contents.resize(bytes_read);
-
             m_IniPtr = ini_load(contents.data(), nullptr);
             return;
         }
@@ -117,16 +126,40 @@ bool Ini::Save(const std::wstring& filename)
         }
 
         size = ini_save(m_IniPtr, data, size); //Store in data buffer
+        const size_t data_length = size - 1;   //data is 0-terminated when using size provided by ini_save(), so don't write the last byte
+
+        //Skip writing if the file already has the same contents, which is common for repeated saves without changes
+        std::string contents_existing;
+        if ( (ReadFileContents(filename, contents_existing)) && (contents_existing.size() == data_length) && (memcmp(contents_existing.data(), data, data_length) == 0) )
+        {
+            delete[] data;
+            return true;
+        }
+
+        //Write to a temporary file and replace the real one with it after, so a crash or full disk in the middle of writing doesn't leave a broken file behind
+        //The temporary file name includes the process ID since dashboard and UI process may save the same file at the same time
+        const std::wstring filename_temp = filename + L"." + std::to_wstring(::GetCurrentProcessId()) + L".tmp";
+        bool write_ok = false;
 
-        FILE* fp = _wfopen(filename.c_str(), L"wt");
+        FILE* fp = _wfopen(filename_temp.c_str(), L"wt");
         if (fp != nullptr)
         {
-            fwrite(data, 1, size - 1, fp); //data is 0-terminated when using size provided by ini_save(), so don't write the last byte
-            fclose(fp);
+            write_ok = (fwrite(data, 1, data_length, fp) == data_length);
+            write_ok = ((fclose(fp) == 0) && (write_ok));
         }
         delete[] data;
 
-        return (fp != nullptr);
+        if (write_ok)
+        {
+            write_ok = (::MoveFileExW(filename_temp.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+        }
+
+        if ( (!write_ok) && (fp != nullptr) )
+        {
+            ::DeleteFileW(filename_temp.c_str());
+        }
+
+        return write_ok;
     }
 
     return false;
@@ -138,11 +171,11 @@ std::string Ini::ReadString(const char* section, const char* key, const char* de
 
     if (section_id != INI_NOT_FOUND)
     {
-        int property_id = ini_find_property(m_IniPtr, section_id, key, 0);
+        const char* value = ini_find_property_value(m_IniPtr, section_id, key, 0);
 
-        if (property_id != INI_NOT_FOUND)
+        if (value != nullptr)
         {
-            return ini_property_value(m_IniPtr, section_id, property_id);
+            return value;
         }
     }
 
@@ -519,6 +552,16 @@ property with the specified name could be found within the specified section, th
 return `INI_NOT_FOUND`. The defined constant `INI_GLOBAL_SECTION` can be used to indicate the global section.
 
 
+ini_find_property_value
+-----------------------
+
+    char const* ini_find_property_value( ini_t const* ini, int section, char const* name, int name_length )
+
+Desktop+: Finds the property with the specified name, within the section with the specified index, and returns its 
+value. Same as calling `ini_find_property` followed by `ini_property_value`, but only walks the property list once. If 
+no property with the specified name could be found within the specified section, NULL is returned.
+
+
 ini_section_add
 ---------------
 
@@ -1001,6 +1044,29 @@ int ini_find_property( ini_t const* ini, int section, char const* name, int name
     }
 
 
+char const* ini_find_property_value( ini_t const* ini, int section, char const* name, int name_length )
+    {
+    int i;
+
+    if( ini && name && section >= 0 && section < ini->section_count)
+        {
+        if( name_length <= 0 ) name_length = (int) INI_STRLEN( name );
+        for( i = 0; i < ini->property_count; ++i )
+            {
+            if( ini->properties[ i ].section == section )
+                {
+                char const* const other = 
+                    ini->properties[ i ].name_large ? ini->properties[ i ].name_large : ini->properties[ i ].name;
+                if( ( INI_STRNICMP( name, other, name_length ) == 0 ) && ( other[name_length] == '\0' ) )
+                    return ini->properties[ i ].value_large ? ini->properties[ i ].value_large : ini->properties[ i ].value;
+                }
+            }
+        }
+
+    return NULL;
+    }
+
+
 int ini_section_add( ini_t* ini, char const* name, int length )
     {
     struct ini_internal_section_t* new_sections;
@@ -1230,7 +1296,8 @@ contributors:
 revision history:
     Desktop+    apply WSSDude's return of wrong sections and properties by find functions fix, fix reading empty properties,
                 fix characters past ASCII range to be detected as whitespace, fix wrong index deleting long property names/values,
-                fix whitespace-only property values causing the rest of the file to be used instead
+                fix whitespace-only property values causing the rest of the file to be used instead,
+                add ini_find_property_value for single-pass lookups
     1.2         using strnicmp for correct length compares, fixed copy-paste bug in ini_property_value_set
     1.1         customization, added documentation, cleanup
     1.0         first publicly released version
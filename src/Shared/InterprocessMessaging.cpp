@@ -104,13 +104,30 @@ DWORD IPCManager::GetUIAppProcessID()
     return pid;
 }
 
-void IPCManager::PostMessageToDashboardApp(IPCMsgID IPC_id, WPARAM w_param, LPARAM l_param) const
+HWND IPCManager::GetTargetWindow(std::atomic<HWND>& window_cached, LPCWSTR class_name) const
 {
-    //We take the cost of finding the window for every message (which isn't frequent anyways) so we don't have to worry about the process going anywhere
-    if (HWND window = ::FindWindow(g_WindowClassNameDashboardApp, nullptr))
+    //Finding the window for every message adds up with input and slider traffic, so only do it again once the cached window is gone
+    //Handles of destroyed windows can be recycled for unrelated windows, so check the class name instead of just IsWindow(). This fails for destroyed windows as well
+    HWND window = window_cached.load();
+    WCHAR window_class_name[64];
+
+    if ( (window == nullptr) || (::GetClassName(window, window_class_name, 64) == 0) || (_wcsicmp(window_class_name, class_name) != 0) )
     {
-        ::PostMessage(window, GetWin32MessageID(IPC_id), w_param, l_param);
+        window = ::FindWindow(class_name, nullptr);
+        window_cached.store(window);
     }
+
+    return window;
+}
+
+bool IPCManager::PostMessageToDashboardApp(IPCMsgID IPC_id, WPARAM w_param, LPARAM l_param) const
+{
+    if (HWND window = GetTargetWindow(m_WindowDashboardApp, g_WindowClassNameDashboardApp))
+    {
+        return (::PostMessage(window, GetWin32MessageID(IPC_id), w_param, l_param) != 0);
+    }
+
+    return false;
 }
 
 void IPCManager::PostConfigMessageToDashboardApp(ConfigID_Bool configid, LPARAM l_param) const
@@ -135,7 +152,7 @@ void IPCManager::PostConfigMessageToDashboardApp(ConfigID_Handle configid, LPARA
 
 void IPCManager::PostMessageToUIApp(IPCMsgID IPC_id, WPARAM w_param, LPARAM l_param) const
 {
-    if (HWND window = ::FindWindow(g_WindowClassNameUIApp, nullptr))
+    if (HWND window = GetTargetWindow(m_WindowUIApp, g_WindowClassNameUIApp))
     {
         ::PostMessage(window, GetWin32MessageID(IPC_id), w_param, l_param);
     }
@@ -163,7 +180,7 @@ void IPCManager::PostConfigMessageToUIApp(ConfigID_Handle configid, LPARAM l_par
 
 void IPCManager::PostMessageToElevatedModeProcess(IPCMsgID IPC_id, WPARAM w_param, LPARAM l_param) const
 {
-    if (HWND window = ::FindWindow(g_WindowClassNameElevatedMode, nullptr))
+    if (HWND window = GetTargetWindow(m_WindowElevatedMode, g_WindowClassNameElevatedMode))
     {
         ::PostMessage(window, GetWin32MessageID(IPC_id), w_param, l_param);
     }
@@ -171,7 +188,7 @@ void IPCManager::PostMessageToElevatedModeProcess(IPCMsgID IPC_id, WPARAM w_para
 
 void IPCManager::SendStringToDashboardApp(ConfigID_String config_id, const std::string& str, HWND source_window) const
 {
-    if (HWND window = ::FindWindow(g_WindowClassNameDashboardApp, nullptr))
+    if (HWND window = GetTargetWindow(m_WindowDashboardApp, g_WindowClassNameDashboardApp))
     {
         COPYDATASTRUCT cds;
         cds.dwData = config_id;
@@ -183,7 +200,7 @@ void IPCManager::SendStringToDashboardApp(ConfigID_String config_id, const std::
 
 void IPCManager::SendStringToUIApp(ConfigID_String config_id, const std::string& str, HWND source_window) const
 {
-    if (HWND window = ::FindWindow(g_WindowClassNameUIApp, nullptr))
+    if (HWND window = GetTargetWindow(m_WindowUIApp, g_WindowClassNameUIApp))
     {
         COPYDATASTRUCT cds;
         cds.dwData = config_id;
@@ -195,7 +212,7 @@ void IPCManager::SendStringToUIApp(ConfigID_String config_id, const std::string&
 
 void IPCManager::SendStringToElevatedModeProcess(IPCElevatedStringID elevated_str_id, const std::string& str, HWND source_window) const
 {
-    if (HWND window = ::FindWindow(g_WindowClassNameElevatedMode, nullptr))
+    if (HWND window = GetTargetWindow(m_WindowElevatedMode, g_WindowClassNameElevatedMode))
     {
         COPYDATASTRUCT cds;
         cds.dwData = elevated_str_id;
@@ -2,11 +2,12 @@
 //It's generally expected to use matching builds of the dashboard overlay and UI application, as the UI is launched by the dashboard process
 //Due to that, there's no version checking or similar, just some raw messages to get things done
 //This header and its implemenation is shared between both applications' code
-//The IPCManager class doesn't write to any variables after construction, so calling it from other threads is safe
+//The IPCManager class doesn't write to any variables after construction apart from the atomic window handle cache, so calling it from other threads is safe
 
 #pragma once
 
 #include <string>
+#include <atomic>
 #define NOMINMAX
 #include <windows.h>
 
@@ -150,6 +151,12 @@ class IPCManager
     private:
         UINT m_RegisteredMessages[ipcmsg_MAX];
 
+        mutable std::atomic<HWND> m_WindowDashboardApp {nullptr};
+        mutable std::atomic<HWND> m_WindowUIApp        {nullptr};
+        mutable std::atomic<HWND> m_WindowElevatedMode {nullptr};
+
+        HWND GetTargetWindow(std::atomic<HWND>& window_cached, LPCWSTR class_name) const;
+
     public:
         IPCManager();
         static IPCManager& Get();
@@ -163,7 +170,7 @@ class IPCManager
         static DWORD GetDashboardAppProcessID();
         static DWORD GetUIAppProcessID();
 
-        void PostMessageToDashboardApp(IPCMsgID IPC_id, WPARAM w_param = 0, LPARAM l_param = 0) const;
+        bool PostMessageToDashboardApp(IPCMsgID IPC_id, WPARAM w_param = 0, LPARAM l_param = 0) const;  //Returns false if the message couldn't be posted
         void PostConfigMessageToDashboardApp(ConfigID_Bool   configid, LPARAM l_param = 0) const;
         void PostConfigMessageToDashboardApp(ConfigID_Int    configid, LPARAM l_param = 0) const;
         void PostConfigMessageToDashboardApp(ConfigID_Float  configid, float value = 0.0f) const;
@@ -116,3 +116,33 @@ void DPLog_DPWinRT_SupportInfo()
     }
 
 }
+
+DPLog_IPCMessageTrace::DPLog_IPCMessageTrace(int message_id, unsigned int message_id_win32, unsigned long long wparam, long long lparam) :
+    m_MessageID(message_id),
+    m_MessageIDWin32(message_id_win32),
+    m_WParam(wparam),
+    m_LParam(lparam),
+    m_StartTime(0)
+{
+    if (loguru::current_verbosity_cutoff() >= 2)
+    {
+        LARGE_INTEGER start_time;
+        ::QueryPerformanceCounter(&start_time);
+        m_StartTime = start_time.QuadPart;
+    }
+}
+
+DPLog_IPCMessageTrace::~DPLog_IPCMessageTrace()
+{
+    if (m_StartTime == 0)
+        return;
+
+    LARGE_INTEGER end_time, frequency;
+    ::QueryPerformanceCounter(&end_time);
+    ::QueryPerformanceFrequency(&frequency);
+
+    const double duration_ms = (end_time.QuadPart - m_StartTime) * 1000.0 / frequency.QuadPart;
+
+    //IPC message ID is ipcmsg_MAX for non-IPCManager messages (browser API, WM_COPYDATA), so also log the Win32 one
+    VLOG_F(2, "IPC message %d (Win32 %u), wParam %llu, lParam %lld handled in %.3f ms", m_MessageID, m_MessageIDWin32, m_WParam, m_LParam, duration_ms);
+}
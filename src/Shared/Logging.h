@@ -15,4 +15,19 @@ static const int k_nDesktopPlusConfigVersion = 2;
 
 void DPLog_Init(const char* name);
 void DPLog_SteamVR_SystemInfo();
-void DPLog_DPWinRT_SupportInfo();
\ No newline at end of file
+void DPLog_DPWinRT_SupportInfo();
+//Logs an IPC message and the time its handler took once it goes out of scope, only if verbosity is 2 or higher (-v 2)
+//Loguru's own scopes don't log their duration here as LOGURU_VERBOSE_SCOPE_ENDINGS is set to 0
+class DPLog_IPCMessageTrace
+{
+    private:
+        int m_MessageID;
+        unsigned int m_MessageIDWin32;
+        unsigned long long m_WParam;
+        long long m_LParam;
+        long long m_StartTime;
+
+    public:
+        DPLog_IPCMessageTrace(int message_id, unsigned int message_id_win32, unsigned long long wparam, long long lparam);
+        ~DPLog_IPCMessageTrace();
+};
@@ -20,7 +20,8 @@
 
 #include <cmath>
 #include <algorithm>
-#include <sstream>
+#include <cctype>
+#include <charconv>
 #include "Matrices.h"
 
 constexpr float DEG2RAD = 3.141593f / 180;
@@ -149,20 +150,33 @@ Matrix3& Matrix3::invert()
 Matrix4::Matrix4(const std::string str)
 {
     float m_temp[16];
-    char c;
-    std::stringstream ss(str);
+    const char* str_pos = str.c_str();
+    const char* str_end = str_pos + str.size();
 
-    ss >> c;
+    //Skip opening bracket
+    while ((str_pos != str_end) && (isspace((unsigned char)*str_pos)))
+        ++str_pos;
+
+    if (str_pos != str_end)
+        ++str_pos;
 
     for (size_t i = 0; i < 16; ++i)
     {
-        ss >> m_temp[i];
+        while ((str_pos != str_end) && (isspace((unsigned char)*str_pos)))
+            ++str_pos;
+
+        std::from_chars_result result = std::from_chars(str_pos, str_end, m_temp[i]);
+
+        if (result.ec != std::errc())
+        {
+            identity();
+            return;
+        }
+
+        str_pos = result.ptr;
     }
 
-    if (!ss.fail())
-        set(m_temp);
-    else
-        identity();
+    set(m_temp);
 }
 
 void Matrix4::setRotation(float x, float y, float z)
@@ -480,17 +494,20 @@ vr::HmdMatrix34_t Matrix4::toOpenVR34() const
 
 std::string Matrix4::toString() const
 {
-    std::stringstream ss;
-    ss << '[';
+    //Shortest representation that reads back to the exact same float
+    char buffer[16 * 32 + 2];
+    char* buffer_pos = buffer;
+    char* buffer_end = buffer + sizeof(buffer);
 
-    for (size_t i = 0; i < 15; ++i)
+    *buffer_pos++ = '[';
+
+    for (size_t i = 0; i < 16; ++i)
     {
-        ss << m[i] << ' ';
+        buffer_pos = std::to_chars(buffer_pos, buffer_end, m[i]).ptr;
+        *buffer_pos++ = (i < 15) ? ' ' : ']';
     }
 
-    ss << m[15] << ']';
-
-    return ss.str();
+    return std::string(buffer, buffer_pos - buffer);
 }
 
 Vector3 Matrix4::getRotation() const
@@ -26,6 +26,13 @@
 #include "Vectors.h"
 #include "openvr.h"
 
+// Desktop+: SSE is part of the x64 baseline, so Matrix4 multiplications use it when available.
+// Additions happen in the same order as the scalar code, so results are identical either way
+#if defined(_M_X64) || defined(__SSE__)
+    #define MATRICES_USE_SSE
+    #include <xmmintrin.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////
 // 2x2 matrix
 ///////////////////////////////////////////////////////////////////////////
@@ -877,10 +884,21 @@ inline Matrix4& Matrix4::operator-=(const Matrix4& rhs)
 
 inline Vector4 Matrix4::operator*(const Vector4& rhs) const
 {
+#ifdef MATRICES_USE_SSE
+    __m128 res = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(rhs.x));
+    res = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m[4]),  _mm_set1_ps(rhs.y)));
+    res = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m[8]),  _mm_set1_ps(rhs.z)));
+    res = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(rhs.w)));
+
+    float out[4];
+    _mm_storeu_ps(out, res);
+    return Vector4(out[0], out[1], out[2], out[3]);
+#else
     return Vector4(m[0]*rhs.x + m[4]*rhs.y + m[8]*rhs.z  + m[12]*rhs.w,
                    m[1]*rhs.x + m[5]*rhs.y + m[9]*rhs.z  + m[13]*rhs.w,
                    m[2]*rhs.x + m[6]*rhs.y + m[10]*rhs.z + m[14]*rhs.w,
                    m[3]*rhs.x + m[7]*rhs.y + m[11]*rhs.z + m[15]*rhs.w);
+#endif
 }
 
 
@@ -896,10 +914,29 @@ inline Vector3 Matrix4::operator*(const Vector3& rhs) const
 
 inline Matrix4 Matrix4::operator*(const Matrix4& n) const
 {
+#ifdef MATRICES_USE_SSE
+    const __m128 col0 = _mm_loadu_ps(&m[0]);
+    const __m128 col1 = _mm_loadu_ps(&m[4]);
+    const __m128 col2 = _mm_loadu_ps(&m[8]);
+    const __m128 col3 = _mm_loadu_ps(&m[12]);
+
+    float out[16];
+    for (int i = 0; i < 16; i += 4)
+    {
+        __m128 res = _mm_mul_ps(col0, _mm_set1_ps(n[i]));
+        res = _mm_add_ps(res, _mm_mul_ps(col1, _mm_set1_ps(n[i+1])));
+        res = _mm_add_ps(res, _mm_mul_ps(col2, _mm_set1_ps(n[i+2])));
+        res = _mm_add_ps(res, _mm_mul_ps(col3, _mm_set1_ps(n[i+3])));
+        _mm_storeu_ps(&out[i], res);
+    }
+
+    return Matrix4(out);
+#else
     return Matrix4(m[0]*n[0]  + m[4]*n[1]  + m[8]*n[2]  + m[12]*n[3],   m[1]*n[0]  + m[5]*n[1]  + m[9]*n[2]  + m[13]*n[3],   m[2]*n[0]  + m[6]*n[1]  + m[10]*n[2]  + m[14]*n[3],   m[3]*n[0]  + m[7]*n[1]  + m[11]*n[2]  + m[15]*n[3],
                    m[0]*n[4]  + m[4]*n[5]  + m[8]*n[6]  + m[12]*n[7],   m[1]*n[4]  + m[5]*n[5]  + m[9]*n[6]  + m[13]*n[7],   m[2]*n[4]  + m[6]*n[5]  + m[10]*n[6]  + m[14]*n[7],   m[3]*n[4]  + m[7]*n[5]  + m[11]*n[6]  + m[15]*n[7],
                    m[0]*n[8]  + m[4]*n[9]  + m[8]*n[10] + m[12]*n[11],  m[1]*n[8]  + m[5]*n[9]  + m[9]*n[10] + m[13]*n[11],  m[2]*n[8]  + m[6]*n[9]  + m[10]*n[10] + m[14]*n[11],  m[3]*n[8]  + m[7]*n[9]  + m[11]*n[10] + m[15]*n[11],
                    m[0]*n[12] + m[4]*n[13] + m[8]*n[14] + m[12]*n[15],  m[1]*n[12] + m[5]*n[13] + m[9]*n[14] + m[13]*n[15],  m[2]*n[12] + m[6]*n[13] + m[10]*n[14] + m[14]*n[15],  m[3]*n[12] + m[7]*n[13] + m[11]*n[14] + m[15]*n[15]);
+#endif
 }
 
 
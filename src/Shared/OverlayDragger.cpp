@@ -441,6 +441,11 @@ void OverlayDragger::DragStart(unsigned int overlay_id)
     m_DragModeMaxWidth            = FLT_MAX;
 
     DragStartBase(false);
+
+    #ifndef DPLUS_UI
+        //Transform is about to be changed without the Overlay class knowing until the drag is done
+        OverlayManager::Get().GetOverlay(overlay_id).InvalidateRuntimeTransformState();
+    #endif
 }
 
 void OverlayDragger::DragStart(vr::VROverlayHandle_t overlay_handle, OverlayOrigin overlay_origin)
@@ -780,6 +785,11 @@ Matrix4 OverlayDragger::DragFinish()
         data.ConfigTransform = matrix_target_relative;
     }
 
+    #ifndef DPLUS_UI
+        //Overlay transform, width and curvature were set without the Overlay class knowing
+        OverlayManager::Get().GetOverlay(m_DragModeOverlayID).InvalidateRuntimeTransformState();
+    #endif
+
     //Reset state
     m_DragModeDeviceID          = -1;
     m_DragModeOverlayID         = k_ulOverlayID_None;
@@ -792,6 +802,11 @@ Matrix4 OverlayDragger::DragFinish()
 
 void OverlayDragger::DragCancel()
 {
+    #ifndef DPLUS_UI
+        //Overlay transform, width and curvature were set without the Overlay class knowing
+        OverlayManager::Get().GetOverlay(m_DragModeOverlayID).InvalidateRuntimeTransformState();
+    #endif
+
     //Reset state
     m_DragModeDeviceID          = -1;
     m_DragModeOverlayID         = k_ulOverlayID_None;
@@ -813,6 +828,11 @@ void OverlayDragger::DragGestureStart(unsigned int overlay_id)
     m_DragModeOverlayHandle = data.ConfigHandle[configid_handle_overlay_state_overlay_handle];
 
     DragGestureStartBase();
+
+    #ifndef DPLUS_UI
+        //Transform is about to be changed without the Overlay class knowing until the drag is done
+        OverlayManager::Get().GetOverlay(overlay_id).InvalidateRuntimeTransformState();
+    #endif
 }
 
 void OverlayDragger::DragGestureStart(vr::VROverlayHandle_t overlay_handle, OverlayOrigin overlay_origin)
@@ -935,6 +955,11 @@ Matrix4 OverlayDragger::DragGestureFinish()
         data.ConfigTransform = matrix_target_relative;
     }
 
+    #ifndef DPLUS_UI
+        //Overlay transform, width and curvature were set without the Overlay class knowing
+        OverlayManager::Get().GetOverlay(m_DragModeOverlayID).InvalidateRuntimeTransformState();
+    #endif
+
     //Reset state
     m_DragGestureActive     = false;
     m_DragModeOverlayID     = k_ulOverlayID_None;
@@ -37,6 +37,60 @@ template <typename T_out, typename T_in> inline typename std::enable_if_t<std::i
     return value_out;
 }
 
+//Binary serialization helpers used by the Serialize()/Deserialize() functions of data sent over IPC
+template <typename T> inline void SerializeWrite(std::string& str, const T& value)
+{
+    str.append((const char*)&value, sizeof(value));
+}
+
+inline void SerializeWriteString(std::string& str, const std::string& value)
+{
+    SerializeWrite(str, value.size());
+    str.append(value);
+}
+
+class SerializeReader
+{
+    private:
+        const std::string& m_Str;
+        size_t m_Pos  = 0;
+        bool m_Failed = false;
+
+    public:
+        SerializeReader(const std::string& str) : m_Str(str) {}
+
+        template <typename T> void Read(T& value)
+        {
+            if ( (m_Failed) || (m_Str.size() - m_Pos < sizeof(value)) )
+            {
+                m_Failed = true;
+                return;
+            }
+
+            std::memcpy(&value, m_Str.data() + m_Pos, sizeof(value));
+            m_Pos += sizeof(value);
+        }
+
+        //Stored length is clamped to length_max to avoid large allocations on garbage data
+        void ReadString(std::string& value, size_t length_max)
+        {
+            size_t length = 0;
+            Read(length);
+            length = std::min(length, length_max);
+
+            if ( (m_Failed) || (m_Str.size() - m_Pos < length) )
+            {
+                m_Failed = true;
+                return;
+            }
+
+            value.assign(m_Str, m_Pos, length);
+            m_Pos += length;
+        }
+
+        bool IsGood() const { return !m_Failed; }
+};
+
 inline float smoothstep(float step, float value_min, float value_max)
 {
     return ((step) * (step) * (3 - 2 * (step))) * (value_max - value_min) + value_min;